@@ -0,0 +1,189 @@
+#pragma once
+
+// Host shared by the bench programs: a system allocator, an entity context holding the tween system,
+// an API registry that loads the plugin and a few timing and random helpers.
+
+#include <foundation/allocator.h>
+#include <foundation/api_registry.h>
+#include <foundation/api_types.h>
+#include <foundation/log.h>
+#include <foundation/profiler.h>
+#include <plugins/entity/entity.h>
+
+#include "../tween.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+void tm_load_plugin(struct tm_api_registry_api *reg, bool load);
+
+static double now(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER f, t;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&t);
+    return (double)t.QuadPart / (double)f.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+#endif
+}
+
+static uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+
+static uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 32);
+}
+
+static void *system_realloc(tm_allocator_i *a, void *ptr, uint64_t old_size, uint64_t new_size, const char *file, uint32_t line)
+{
+    if (!new_size)
+    {
+        free(ptr);
+        return 0;
+    }
+    return realloc(ptr, new_size);
+}
+
+static tm_allocator_i system_allocator = { .realloc = system_realloc };
+
+static struct tm_allocator_api allocator_api = { .system = &system_allocator };
+
+static tm_entity_system_i tween_system;
+static double delta_time = 1.0 / 60.0;
+
+static void create_child_allocator(tm_entity_context_o *ctx, const char *name, tm_allocator_i *a)
+{
+    *a = system_allocator;
+}
+
+static void destroy_child_allocator(tm_entity_context_o *ctx, tm_allocator_i *a)
+{
+}
+
+static void register_system(tm_entity_context_o *ctx, const tm_entity_system_i *system)
+{
+    tween_system = *system;
+}
+
+static double get_blackboard_double(tm_entity_context_o *ctx, tm_strhash_t id, double def)
+{
+    return TM_STRHASH_EQUAL(id, TM_ENTITY_BB__DELTA_TIME) ? delta_time : def;
+}
+
+static tm_component_type_t lookup_component_type(tm_entity_context_o *ctx, tm_strhash_t name_hash)
+{
+    return (tm_component_type_t){ 0 };
+}
+
+static void register_engine(tm_entity_context_o *ctx, const tm_engine_i *engine)
+{
+}
+
+static struct tm_entity_api entity_api = {
+    .create_child_allocator = create_child_allocator,
+    .destroy_child_allocator = destroy_child_allocator,
+    .register_system = register_system,
+    .get_blackboard_double = get_blackboard_double,
+    .lookup_component_type = lookup_component_type,
+    .register_engine = register_engine,
+};
+
+// Never enabled, so the plugin's profiler scopes cost what they do in a game that isn't profiling.
+static bool profiler_enabled;
+
+static struct tm_profiler_api profiler_api = { .enabled = &profiler_enabled };
+
+static void logger_print(enum tm_log_type log_type, const char *msg)
+{
+    fputs(msg, stderr);
+}
+
+static int logger_printf(enum tm_log_type log_type, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const int res = vfprintf(stderr, format, args);
+    va_end(args);
+    return res;
+}
+
+static struct tm_logger_api logger_api = { .print = logger_print, .printf = logger_printf };
+
+static struct tm_tween_api tween_api;
+static tm_entity_register_engines_i *register_engines;
+
+static void registry_set(const char *name, tm_version_t version, const void *api, uint32_t bytes)
+{
+    if (!strcmp(name, "tm_tween_api"))
+        memcpy(&tween_api, api, bytes);
+}
+
+static void registry_remove(const void *api)
+{
+}
+
+static void *registry_get(const char *name, tm_version_t version)
+{
+    if (!strcmp(name, "tm_entity_api"))
+        return &entity_api;
+    if (!strcmp(name, "tm_tween_api"))
+        return &tween_api;
+    if (!strcmp(name, "tm_profiler_api"))
+        return &profiler_api;
+    if (!strcmp(name, "tm_allocator_api"))
+        return &allocator_api;
+    if (!strcmp(name, "tm_logger_api"))
+        return &logger_api;
+    return 0;
+}
+
+static void registry_add_implementation(const char *name, tm_version_t version, const void *implementation)
+{
+    if (!strcmp(name, "tm_entity_register_engines_simulation_i"))
+        register_engines = (tm_entity_register_engines_i *)implementation;
+}
+
+static void registry_remove_implementation(const char *name, tm_version_t version, const void *implementation)
+{
+}
+
+static struct tm_api_registry_api registry = {
+    .set = registry_set,
+    .remove = registry_remove,
+    .get = registry_get,
+    .add_implementation = registry_add_implementation,
+    .remove_implementation = registry_remove_implementation,
+};
+
+static tm_entity_context_o *const context = 0;
+
+static void begin_manager(void)
+{
+    register_engines(context);
+}
+
+static void end_manager(void)
+{
+    tween_system.shutdown(context, tween_system.inst, 0);
+}
+
+static void update(void)
+{
+    tween_system.update(context, tween_system.inst, 0);
+}
+
@@ -0,0 +1,26 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/allocator.h.
+
+#include "api_types.h"
+
+typedef struct tm_allocator_o tm_allocator_o;
+
+typedef struct tm_allocator_i
+{
+    tm_allocator_o *inst;
+    uint32_t mem_scope;
+    uint32_t padding_4;
+    void *(*realloc)(struct tm_allocator_i *a, void *ptr, uint64_t old_size, uint64_t new_size, const char *file, uint32_t line);
+} tm_allocator_i;
+
+#define tm_alloc(a, sz) (a)->realloc(a, 0, 0, sz, __FILE__, __LINE__)
+#define tm_free(a, p, sz) (a)->realloc(a, p, sz, 0, __FILE__, __LINE__)
+#define tm_realloc(a, p, old_sz, new_sz) (a)->realloc(a, p, old_sz, new_sz, __FILE__, __LINE__)
+
+struct tm_allocator_api
+{
+    struct tm_allocator_i *system;
+};
+
+#define tm_allocator_api_version TM_VERSION(1, 0, 0)
@@ -0,0 +1,32 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/api_registry.h.
+
+#include "api_types.h"
+
+struct tm_api_registry_api
+{
+    void (*set)(const char *name, tm_version_t version, const void *api, uint32_t bytes);
+    void (*remove)(const void *api);
+    void *(*get)(const char *name, tm_version_t version);
+    void (*add_implementation)(const char *name, tm_version_t version, const void *implementation);
+    void (*remove_implementation)(const char *name, tm_version_t version, const void *implementation);
+};
+
+#define tm_get_api(reg, TYPE) (struct TYPE *)(reg)->get(#TYPE, TYPE##_version)
+
+#define tm_set_or_remove_api(reg, load, TYPE, impl)                   \
+    do {                                                              \
+        if (load)                                                     \
+            (reg)->set(#TYPE, TYPE##_version, impl, sizeof(*(impl))); \
+        else                                                          \
+            (reg)->remove(impl);                                      \
+    } while (0)
+
+#define tm_add_or_remove_implementation(reg, load, TYPE, impl)               \
+    do {                                                                     \
+        if (load)                                                            \
+            (reg)->add_implementation(#TYPE, TYPE##_version, impl);          \
+        else                                                                 \
+            (reg)->remove_implementation(#TYPE, TYPE##_version, impl);       \
+    } while (0)
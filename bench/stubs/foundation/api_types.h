@@ -0,0 +1,91 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/api_types.h. Only what the tween plugin uses.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_MSC_VER)
+#define TM_DLL_EXPORT __declspec(dllexport)
+#else
+#define TM_DLL_EXPORT __attribute__((visibility("default")))
+#endif
+
+typedef struct tm_version_t
+{
+    uint32_t major, minor, patch;
+} tm_version_t;
+
+#define TM_VERSION(major, minor, patch) ((tm_version_t){ major, minor, patch })
+
+typedef struct tm_strhash_t
+{
+    uint64_t u64;
+} tm_strhash_t;
+
+#define TM_STATIC_HASH(s, v) ((tm_strhash_t){ v })
+#define TM_STRHASH(x) ((tm_strhash_t){ x })
+#define TM_STRHASH_U64(x) ((x).u64)
+#define TM_STRHASH_EQUAL(a, b) ((a).u64 == (b).u64)
+
+typedef struct tm_vec2_t
+{
+    float x, y;
+} tm_vec2_t;
+
+typedef struct tm_vec3_t
+{
+    float x, y, z;
+} tm_vec3_t;
+
+typedef struct tm_vec4_t
+{
+    float x, y, z, w;
+} tm_vec4_t;
+
+typedef struct tm_rect_t
+{
+    float x, y, w, h;
+} tm_rect_t;
+
+typedef struct tm_tt_type_t
+{
+    uint64_t u64;
+} tm_tt_type_t;
+
+typedef struct tm_tt_id_t
+{
+    union {
+        uint64_t u64;
+        struct {
+            uint64_t type : 10;
+            uint64_t generation : 22;
+            uint64_t index : 32;
+        };
+    };
+} tm_tt_id_t;
+
+typedef struct tm_entity_t
+{
+    union {
+        struct {
+            uint32_t index;
+            uint32_t generation;
+        };
+        uint64_t u64;
+    };
+} tm_entity_t;
+
+#define TM_INHERITS(TYPE) TYPE
+
+#define TM_CONCAT_INNER(a, b) a##b
+#define TM_CONCAT(a, b) TM_CONCAT_INNER(a, b)
+#define TM_PAD(n) char TM_CONCAT(_padding_, __LINE__)[n]
+
+typedef struct tm_transform_t
+{
+    tm_vec3_t pos;
+    tm_vec4_t rot;
+    tm_vec3_t scale;
+} tm_transform_t;
@@ -0,0 +1,101 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/atomics.inl.
+
+#include "api_types.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+typedef uint32_t atomic_uint32_t;
+typedef uint64_t atomic_uint64_t;
+
+#if defined(_MSC_VER)
+
+static inline uint32_t atomic_load_uint32_t(atomic_uint32_t *object)
+{
+    return (uint32_t)_InterlockedOr((volatile long *)object, 0);
+}
+
+static inline uint64_t atomic_load_uint64_t(atomic_uint64_t *object)
+{
+    return (uint64_t)_InterlockedOr64((volatile __int64 *)object, 0);
+}
+
+static inline void atomic_store_uint32_t(atomic_uint32_t *object, uint32_t desired)
+{
+    _InterlockedExchange((volatile long *)object, (long)desired);
+}
+
+static inline void atomic_store_uint64_t(atomic_uint64_t *object, uint64_t desired)
+{
+    _InterlockedExchange64((volatile __int64 *)object, (__int64)desired);
+}
+
+static inline uint32_t atomic_fetch_add_uint32_t(atomic_uint32_t *object, uint32_t operand)
+{
+    return (uint32_t)_InterlockedExchangeAdd((volatile long *)object, (long)operand);
+}
+
+static inline uint64_t atomic_fetch_add_uint64_t(atomic_uint64_t *object, uint64_t operand)
+{
+    return (uint64_t)_InterlockedExchangeAdd64((volatile __int64 *)object, (__int64)operand);
+}
+
+static inline uint64_t atomic_exchange_uint64_t(atomic_uint64_t *object, uint64_t desired)
+{
+    return (uint64_t)_InterlockedExchange64((volatile __int64 *)object, (__int64)desired);
+}
+
+static inline bool atomic_compare_exchange_weak_uint64_t(atomic_uint64_t *object, uint64_t *expected, uint64_t desired)
+{
+    const uint64_t old = (uint64_t)_InterlockedCompareExchange64((volatile __int64 *)object, (__int64)desired, (__int64)*expected);
+    const bool exchanged = old == *expected;
+    *expected = old;
+    return exchanged;
+}
+
+#else
+
+static inline uint32_t atomic_load_uint32_t(atomic_uint32_t *object)
+{
+    return __atomic_load_n(object, __ATOMIC_SEQ_CST);
+}
+
+static inline uint64_t atomic_load_uint64_t(atomic_uint64_t *object)
+{
+    return __atomic_load_n(object, __ATOMIC_SEQ_CST);
+}
+
+static inline void atomic_store_uint32_t(atomic_uint32_t *object, uint32_t desired)
+{
+    __atomic_store_n(object, desired, __ATOMIC_SEQ_CST);
+}
+
+static inline void atomic_store_uint64_t(atomic_uint64_t *object, uint64_t desired)
+{
+    __atomic_store_n(object, desired, __ATOMIC_SEQ_CST);
+}
+
+static inline uint32_t atomic_fetch_add_uint32_t(atomic_uint32_t *object, uint32_t operand)
+{
+    return __atomic_fetch_add(object, operand, __ATOMIC_SEQ_CST);
+}
+
+static inline uint64_t atomic_fetch_add_uint64_t(atomic_uint64_t *object, uint64_t operand)
+{
+    return __atomic_fetch_add(object, operand, __ATOMIC_SEQ_CST);
+}
+
+static inline uint64_t atomic_exchange_uint64_t(atomic_uint64_t *object, uint64_t desired)
+{
+    return __atomic_exchange_n(object, desired, __ATOMIC_SEQ_CST);
+}
+
+static inline bool atomic_compare_exchange_weak_uint64_t(atomic_uint64_t *object, uint64_t *expected, uint64_t desired)
+{
+    return __atomic_compare_exchange_n(object, expected, desired, true, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+#endif
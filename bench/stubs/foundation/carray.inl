@@ -0,0 +1,57 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/carray.inl: a stretchy buffer with a
+// { size, capacity } header stored in front of the data.
+
+#include "allocator.h"
+
+#include <string.h>
+
+typedef struct tm_carray_header_t
+{
+    uint64_t capacity;
+    uint64_t size;
+} tm_carray_header_t;
+
+#define tm_carray_header(a) ((tm_carray_header_t *)((uint8_t *)(a) - sizeof(tm_carray_header_t)))
+#define tm_carray_size(a) ((a) ? tm_carray_header(a)->size : 0)
+#define tm_carray_bytes(a) (tm_carray_size(a) * sizeof(*(a)))
+#define tm_carray_end(a) ((a) ? (a) + tm_carray_size(a) : 0)
+#define tm_carray_last(a) ((a) ? tm_carray_end(a) - 1 : 0)
+#define tm_carray_capacity(a) ((a) ? tm_carray_header(a)->capacity : 0)
+#define tm_carray_needs_to_grow(a, n) ((n) > tm_carray_capacity(a))
+#define tm_carray_pop(a) ((a)[--tm_carray_header(a)->size])
+#define tm_carray_shrink(a, n) ((a) ? tm_carray_header(a)->size = (n) : 0)
+#define tm_carray_grow(a, n, allocator) ((a) = tm_carray_grow_internal((void *)(a), n, sizeof(*(a)), allocator, __FILE__, __LINE__))
+#define tm_carray_ensure(a, n, allocator) (tm_carray_needs_to_grow(a, n) ? tm_carray_grow(a, n, allocator) : 0)
+#define tm_carray_set_capacity(a, n, allocator) ((a) = tm_carray_set_capacity_internal((void *)(a), n, sizeof(*(a)), allocator, __FILE__, __LINE__))
+#define tm_carray_resize(a, n, allocator) (tm_carray_ensure(a, n, allocator), (a) ? tm_carray_header(a)->size = (n) : 0)
+#define tm_carray_push(a, item, allocator) (tm_carray_ensure(a, tm_carray_size(a) + 1, allocator), (a)[tm_carray_header(a)->size++] = (item), (a) + tm_carray_header(a)->size - 1)
+#define tm_carray_push_array(a, items, n, allocator) (tm_carray_ensure(a, tm_carray_size(a) + (n), allocator), memcpy((a) + tm_carray_size(a), (items), (n) * sizeof(*(a))), tm_carray_header(a)->size += (n), (a) + tm_carray_header(a)->size - (n))
+#define tm_carray_free(a, allocator) ((*(void **)&(a)) = tm_carray_set_capacity_internal((void *)(a), 0, sizeof(*(a)), allocator, __FILE__, __LINE__))
+
+static inline void *tm_carray_set_capacity_internal(void *arr, uint64_t new_capacity, uint64_t item_size, tm_allocator_i *allocator, const char *file, uint32_t line)
+{
+    uint8_t *p = arr ? (uint8_t *)tm_carray_header(arr) : 0;
+    const uint64_t extra = sizeof(tm_carray_header_t);
+    const uint64_t size = tm_carray_size(arr);
+    const uint64_t bytes_before = arr ? item_size * tm_carray_capacity(arr) + extra : 0;
+    const uint64_t bytes_after = new_capacity ? item_size * new_capacity + extra : 0;
+    uint8_t *new_p = (uint8_t *)allocator->realloc(allocator, p, bytes_before, bytes_after, file, line);
+    void *new_a = new_p ? new_p + extra : new_p;
+    if (new_a) {
+        tm_carray_header(new_a)->size = size < new_capacity ? size : new_capacity;
+        tm_carray_header(new_a)->capacity = new_capacity;
+    }
+    return new_a;
+}
+
+static inline void *tm_carray_grow_internal(void *arr, uint64_t to_at_least, uint64_t item_size, tm_allocator_i *allocator, const char *file, uint32_t line)
+{
+    const uint64_t capacity = arr ? tm_carray_capacity(arr) : 0;
+    if (capacity >= to_at_least)
+        return arr;
+    const uint64_t min_new_capacity = capacity ? capacity * 2 : 16;
+    const uint64_t new_capacity = min_new_capacity > to_at_least ? min_new_capacity : to_at_least;
+    return tm_carray_set_capacity_internal(arr, new_capacity, item_size, allocator, file, line);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/job_system.h.
+
+#include "api_types.h"
+
+typedef struct tm_atomic_counter_o tm_atomic_counter_o;
+
+typedef struct tm_jobdecl_t
+{
+    void (*task)(void *data);
+    void *data;
+    uint32_t pin_thread_handle;
+    TM_PAD(4);
+} tm_jobdecl_t;
+
+struct tm_job_system_api
+{
+    tm_atomic_counter_o *(*run_jobs)(tm_jobdecl_t *jobs, uint32_t num_jobs);
+    void (*wait_for_counter_and_free)(tm_atomic_counter_o *counter);
+};
+
+#define tm_job_system_api_version TM_VERSION(1, 0, 0)
@@ -0,0 +1,14 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/localizer.h.
+
+#include "api_types.h"
+
+#define TM_LOCALIZE_LATER(s) (s)
+
+struct tm_localizer_api
+{
+    const char *(*localize)(const char *s);
+};
+
+#define tm_localizer_api_version TM_VERSION(1, 0, 0)
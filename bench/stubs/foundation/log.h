@@ -0,0 +1,19 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/log.h.
+
+#include "api_types.h"
+
+enum tm_log_type {
+    TM_LOG_TYPE_INFO,
+    TM_LOG_TYPE_DEBUG,
+    TM_LOG_TYPE_ERROR,
+};
+
+struct tm_logger_api
+{
+    void (*print)(enum tm_log_type log_type, const char *msg);
+    int (*printf)(enum tm_log_type log_type, const char *format, ...);
+};
+
+#define tm_logger_api_version TM_VERSION(1, 0, 0)
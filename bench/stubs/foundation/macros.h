@@ -0,0 +1,10 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/macros.h.
+
+#include "api_types.h"
+
+#define TM_ARRAY_COUNT(a) (sizeof(a) / sizeof(*(a)))
+#define TM_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define TM_MAX(a, b) ((a) > (b) ? (a) : (b))
+#define TM_CLAMP(x, lo, hi) TM_MIN(TM_MAX(x, lo), hi)
@@ -0,0 +1,28 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/profiler.h.
+
+#include "api_types.h"
+
+struct tm_profiler_api
+{
+    // Points to true while the profiler records.
+    bool *enabled;
+
+    uint64_t (*begin)(const char *name, const char *category, const char *object);
+    void (*end)(uint64_t begin_id);
+};
+
+#define tm_profiler_api_version TM_VERSION(1, 0, 0)
+
+#define TM_PROFILER_BEGIN_LOCAL_SCOPE(tag) \
+    const uint64_t tag##__profiler_id = *tm_profiler_api->enabled ? tm_profiler_api->begin(#tag, "", "") : 0
+
+#define TM_PROFILER_END_LOCAL_SCOPE(tag) \
+    do { if (tag##__profiler_id) tm_profiler_api->end(tag##__profiler_id); } while (0)
+
+#define TM_PROFILER_BEGIN_FUNC_SCOPE() \
+    const uint64_t tm__profiler_func_id = *tm_profiler_api->enabled ? tm_profiler_api->begin(__FUNCTION__, "", "") : 0
+
+#define TM_PROFILER_END_FUNC_SCOPE() \
+    do { if (tm__profiler_func_id) tm_profiler_api->end(tm__profiler_func_id); } while (0)
@@ -0,0 +1,27 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/temp_allocator.h.
+
+#include "api_types.h"
+
+struct tm_allocator_i;
+
+typedef struct tm_temp_allocator_o tm_temp_allocator_o;
+
+typedef struct tm_temp_allocator_i
+{
+    tm_temp_allocator_o *inst;
+    void *(*realloc)(tm_temp_allocator_o *inst, void *ptr, uint64_t old_size, uint64_t new_size);
+} tm_temp_allocator_i;
+
+struct tm_temp_allocator_api
+{
+    tm_temp_allocator_i *(*create)(struct tm_allocator_i *backing);
+    void (*destroy)(tm_temp_allocator_i *ta);
+};
+
+#define tm_temp_allocator_api_version TM_VERSION(1, 0, 0)
+
+#define TM_INIT_TEMP_ALLOCATOR(ta) tm_temp_allocator_i *ta = tm_temp_allocator_api->create(0)
+#define TM_SHUTDOWN_TEMP_ALLOCATOR(ta) tm_temp_allocator_api->destroy(ta)
+#define tm_temp_alloc(ta, sz) (ta)->realloc((ta)->inst, 0, 0, sz)
@@ -0,0 +1,60 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/the_truth.h.
+
+#include "api_types.h"
+
+struct tm_temp_allocator_i;
+
+typedef struct tm_the_truth_o tm_the_truth_o;
+typedef struct tm_the_truth_object_o tm_the_truth_object_o;
+
+enum tm_the_truth_property_type {
+    TM_THE_TRUTH_PROPERTY_TYPE_NONE,
+    TM_THE_TRUTH_PROPERTY_TYPE_BOOL,
+    TM_THE_TRUTH_PROPERTY_TYPE_UINT32_T,
+    TM_THE_TRUTH_PROPERTY_TYPE_UINT64_T,
+    TM_THE_TRUTH_PROPERTY_TYPE_FLOAT,
+    TM_THE_TRUTH_PROPERTY_TYPE_DOUBLE,
+    TM_THE_TRUTH_PROPERTY_TYPE_STRING,
+    TM_THE_TRUTH_PROPERTY_TYPE_BUFFER,
+    TM_THE_TRUTH_PROPERTY_TYPE_REFERENCE,
+    TM_THE_TRUTH_PROPERTY_TYPE_SUBOBJECT,
+    TM_THE_TRUTH_PROPERTY_TYPE_REFERENCE_SET,
+    TM_THE_TRUTH_PROPERTY_TYPE_SUBOBJECT_SET,
+};
+
+typedef struct tm_the_truth_property_definition_t
+{
+    const char *name;
+    uint32_t type;
+    uint32_t editor;
+    const char *type_hash_name;
+    tm_strhash_t type_hash;
+} tm_the_truth_property_definition_t;
+
+#define TM_TT_ASPECT__PROPERTIES TM_STATIC_HASH("tm_properties_aspect_i", 0xc6b96fe252358a12ULL)
+
+#define tm_tt_type(id) ((tm_tt_type_t){ (id).type })
+
+struct tm_the_truth_api
+{
+    tm_tt_type_t (*create_object_type)(tm_the_truth_o *tt, const char *name, const tm_the_truth_property_definition_t *properties, uint32_t num_properties);
+    void (*set_aspect)(tm_the_truth_o *tt, tm_tt_type_t type, tm_strhash_t aspect, const void *data);
+    tm_strhash_t (*type_name_hash)(const tm_the_truth_o *tt, tm_tt_type_t type);
+    const tm_the_truth_object_o *(*read)(const tm_the_truth_o *tt, tm_tt_id_t id);
+    bool (*get_bool)(const tm_the_truth_o *tt, const tm_the_truth_object_o *obj, uint32_t property);
+    uint32_t (*get_uint32_t)(const tm_the_truth_o *tt, const tm_the_truth_object_o *obj, uint32_t property);
+    float (*get_float)(const tm_the_truth_o *tt, const tm_the_truth_object_o *obj, uint32_t property);
+    tm_tt_id_t (*get_reference)(const tm_the_truth_o *tt, const tm_the_truth_object_o *obj, uint32_t property);
+    tm_tt_id_t (*get_subobject)(const tm_the_truth_o *tt, const tm_the_truth_object_o *obj, uint32_t property);
+    const tm_tt_id_t *(*get_subobject_set)(const tm_the_truth_o *tt, const tm_the_truth_object_o *obj, uint32_t property, struct tm_temp_allocator_i *ta);
+};
+
+#define tm_the_truth_api_version TM_VERSION(1, 0, 0)
+
+#define tm_tt_read(tt, id) tm_the_truth_api->read(tt, id)
+
+typedef void tm_the_truth_create_types_i(struct tm_the_truth_o *tt);
+
+#define tm_the_truth_create_types_i_version TM_VERSION(1, 0, 0)
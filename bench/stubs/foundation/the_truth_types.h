@@ -0,0 +1,18 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's foundation/the_truth_types.h.
+
+#include "api_types.h"
+
+#define TM_TT_TYPE_HASH__BOOL TM_STATIC_HASH("tm_bool", 0xaed3caa5c516d191ULL)
+#define TM_TT_TYPE_HASH__UINT32_T TM_STATIC_HASH("tm_uint32_t", 0xeaf325d06c5cb568ULL)
+#define TM_TT_TYPE_HASH__UINT64_T TM_STATIC_HASH("tm_uint64_t", 0xb11aa2e510ce635eULL)
+#define TM_TT_TYPE_HASH__FLOAT TM_STATIC_HASH("tm_float", 0x6d0a4e744c45523bULL)
+#define TM_TT_TYPE_HASH__DOUBLE TM_STATIC_HASH("tm_double", 0x0ef2dd9a55accbe4ULL)
+#define TM_TT_TYPE_HASH__STRING TM_STATIC_HASH("tm_string", 0xa84ae1fca1a3e0cbULL)
+#define TM_TT_TYPE_HASH__STRING_HASH TM_STATIC_HASH("tm_string_hash", 0xed35f02cc91a9dbaULL)
+#define TM_TT_TYPE_HASH__VEC2 TM_STATIC_HASH("tm_vec2_t", 0x5ea1bb7b6537de46ULL)
+#define TM_TT_TYPE_HASH__VEC3 TM_STATIC_HASH("tm_vec3_t", 0x8d1487af36b1e3e1ULL)
+#define TM_TT_TYPE_HASH__VEC4 TM_STATIC_HASH("tm_vec4_t", 0xdf81286b1233bab6ULL)
+#define TM_TT_TYPE_HASH__ROTATION TM_STATIC_HASH("tm_rotation", 0xa4d2f46b41c9d717ULL)
+#define TM_TT_TYPE_HASH__COLOR_RGBA TM_STATIC_HASH("tm_color_rgba", 0x11e53fa0440a07e4ULL)
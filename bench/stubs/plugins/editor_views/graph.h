@@ -0,0 +1,5 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's plugins/editor_views/graph.h.
+
+#include <foundation/api_types.h>
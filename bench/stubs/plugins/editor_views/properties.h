@@ -0,0 +1,26 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's plugins/editor_views/properties.h.
+
+#include <foundation/api_types.h>
+
+struct tm_the_truth_o;
+
+typedef struct tm_properties_ui_args_t
+{
+    struct tm_the_truth_o *tt;
+} tm_properties_ui_args_t;
+
+typedef struct tm_properties_aspect_i
+{
+    float (*custom_ui)(struct tm_properties_ui_args_t *args, tm_rect_t item_rect, tm_tt_id_t object, uint32_t indent);
+    float (*custom_subobject_ui)(struct tm_properties_ui_args_t *args, tm_rect_t item_rect, const char *name, const char *tooltip, tm_tt_id_t object, uint32_t indent);
+} tm_properties_aspect_i;
+
+struct tm_properties_view_api
+{
+    float (*ui_uint32_popup_picker)(struct tm_properties_ui_args_t *args, tm_rect_t item_rect, const char *name, const char *tooltip, tm_tt_id_t object, uint32_t property, const char *const *items, uint32_t num_items);
+    float (*ui_property_default)(struct tm_properties_ui_args_t *args, tm_rect_t item_rect, tm_tt_id_t object, uint32_t indent, uint32_t property);
+};
+
+#define tm_properties_view_api_version TM_VERSION(1, 0, 0)
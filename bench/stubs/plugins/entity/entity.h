@@ -0,0 +1,101 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's plugins/entity/entity.h.
+
+#include <foundation/api_types.h>
+
+struct tm_allocator_i;
+
+typedef struct tm_entity_context_o tm_entity_context_o;
+typedef struct tm_entity_commands_o tm_entity_commands_o;
+typedef struct tm_entity_system_o tm_entity_system_o;
+typedef struct tm_engine_o tm_engine_o;
+typedef struct tm_component_manager_o tm_component_manager_o;
+
+typedef struct tm_component_type_t
+{
+    uint64_t index;
+} tm_component_type_t;
+
+#define TM_MAX_COMPONENTS_FOR_ENGINE 16
+
+typedef struct tm_component_i
+{
+    const char *name;
+    uint32_t bytes;
+    TM_PAD(4);
+    const void *default_data;
+    tm_component_manager_o *manager;
+} tm_component_i;
+
+typedef struct tm_engine_update_array_t
+{
+    tm_entity_t *entities;
+    void *components[TM_MAX_COMPONENTS_FOR_ENGINE];
+    uint32_t component_bytes[TM_MAX_COMPONENTS_FOR_ENGINE];
+    uint32_t n;
+    TM_PAD(4);
+} tm_engine_update_array_t;
+
+typedef struct tm_engine_update_set_t
+{
+    const struct tm_engine_i *engine;
+    uint32_t total_entities;
+    uint32_t num_arrays;
+    tm_engine_update_array_t arrays[];
+} tm_engine_update_set_t;
+
+typedef struct tm_engine_i
+{
+    const char *ui_name;
+    tm_strhash_t hash;
+    bool disabled;
+    bool exclusive;
+    TM_PAD(2);
+    uint32_t num_components;
+    tm_component_type_t components[TM_MAX_COMPONENTS_FOR_ENGINE];
+    bool writes[TM_MAX_COMPONENTS_FOR_ENGINE];
+    tm_strhash_t before_me[16];
+    tm_strhash_t after_me[16];
+    tm_engine_o *inst;
+    void (*update)(tm_engine_o *inst, tm_engine_update_set_t *data, struct tm_entity_commands_o *commands);
+} tm_engine_i;
+
+#define TM_ENTITY_BB__DELTA_TIME TM_STATIC_HASH("delta_time", 0x53e3339e2fe75b8cULL)
+#define TM_ENTITY_BB__EDITOR TM_STATIC_HASH("editor", 0xf76c66a1ef2e2f59ULL)
+
+typedef struct tm_entity_system_i
+{
+    const char *ui_name;
+    tm_strhash_t hash;
+    bool disabled;
+    bool exclusive;
+    tm_entity_system_o *inst;
+    void (*init)(tm_entity_context_o *ctx, tm_entity_system_o *inst, tm_entity_commands_o *commands);
+    void (*update)(tm_entity_context_o *ctx, tm_entity_system_o *inst, tm_entity_commands_o *commands);
+    void (*shutdown)(tm_entity_context_o *ctx, tm_entity_system_o *inst, tm_entity_commands_o *commands);
+} tm_entity_system_i;
+
+struct tm_entity_api
+{
+    void (*create_child_allocator)(tm_entity_context_o *ctx, const char *name, struct tm_allocator_i *a);
+    void (*destroy_child_allocator)(tm_entity_context_o *ctx, struct tm_allocator_i *a);
+    void (*register_system)(tm_entity_context_o *ctx, const tm_entity_system_i *system);
+    double (*get_blackboard_double)(tm_entity_context_o *ctx, tm_strhash_t id, double def);
+    tm_component_type_t (*register_component)(tm_entity_context_o *ctx, const tm_component_i *com);
+    tm_component_type_t (*lookup_component_type)(tm_entity_context_o *ctx, tm_strhash_t name_hash);
+    const tm_component_i *(*component)(tm_entity_context_o *ctx, tm_component_type_t component_type);
+    void (*register_engine)(tm_entity_context_o *ctx, const tm_engine_i *engine);
+    void *(*add_component)(tm_entity_context_o *ctx, tm_entity_t e, tm_component_type_t component);
+    void *(*get_component)(tm_entity_context_o *ctx, tm_entity_t e, tm_component_type_t component);
+};
+
+#define tm_entity_api_version TM_VERSION(1, 0, 0)
+
+typedef void tm_entity_register_engines_i(tm_entity_context_o *ctx);
+
+typedef void tm_entity_create_component_i(tm_entity_context_o *ctx);
+
+#define tm_entity_create_component_i_version TM_VERSION(1, 0, 0)
+
+#define tm_entity_register_engines_simulation_i_version TM_VERSION(1, 0, 0)
@@ -0,0 +1,16 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's plugins/entity/transform_component.h.
+
+#include <foundation/api_types.h>
+
+#define TM_TT_TYPE__TRANSFORM_COMPONENT "tm_transform_component"
+#define TM_TT_TYPE_HASH__TRANSFORM_COMPONENT TM_STATIC_HASH("tm_transform_component", 0x8c878bd87b046f80ULL)
+
+typedef struct tm_transform_component_t
+{
+    tm_transform_t world;
+    tm_transform_t local;
+    uint32_t version;
+    TM_PAD(4);
+} tm_transform_component_t;
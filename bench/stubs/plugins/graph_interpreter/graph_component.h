@@ -0,0 +1,7 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's plugins/graph_interpreter/graph_component.h.
+
+#include <foundation/api_types.h>
+
+#define TM_TT_TYPE__GRAPH_COMPONENT "tm_graph_component"
@@ -0,0 +1,55 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's plugins/graph_interpreter/graph_component_node_type.h.
+
+#include <foundation/api_types.h>
+
+struct tm_graph_interpreter_context_t;
+struct tm_graph_interpreter_o;
+struct tm_the_truth_o;
+
+#define TM_TT_TYPE_HASH__GRAPH_EVENT TM_STATIC_HASH("tm_graph_event", 0xb18ebba36d0cb89dULL)
+
+typedef union tm_graph_generic_value_t {
+    float *f;
+    double *d;
+    bool *boolean;
+    uint32_t *u32;
+    uint64_t *u64;
+    tm_vec2_t *vec2;
+    tm_vec3_t *vec3;
+    tm_vec4_t *vec4;
+} tm_graph_generic_value_t;
+
+typedef struct tm_graph_component_connector_t
+{
+    const char *name;
+    tm_strhash_t type_hash;
+    tm_strhash_t edit_type_hash;
+    bool optional;
+    const tm_graph_generic_value_t *default_value;
+} tm_graph_component_connector_t;
+
+typedef struct tm_graph_component_static_connectors_t
+{
+    tm_graph_component_connector_t in[16];
+    uint32_t num_in;
+    tm_graph_component_connector_t out[16];
+    uint32_t num_out;
+} tm_graph_component_static_connectors_t;
+
+typedef struct tm_graph_component_node_type_i
+{
+    const char *definition_path;
+    const char *name;
+    const char *display_name;
+    const char *category;
+    tm_graph_component_static_connectors_t static_connectors;
+    void (*run)(struct tm_graph_interpreter_context_t *ctx);
+} tm_graph_component_node_type_i;
+
+#define tm_graph_component_node_type_i_version TM_VERSION(1, 0, 0)
+
+typedef bool tm_graph_component_compile_data_i(struct tm_graph_interpreter_o *gr, uint32_t wire, const struct tm_the_truth_o *tt, tm_tt_id_t data_id, tm_strhash_t to_type_hash);
+
+#define tm_graph_component_compile_data_i_version TM_VERSION(1, 0, 0)
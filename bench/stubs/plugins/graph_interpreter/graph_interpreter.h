@@ -0,0 +1,35 @@
+#pragma once
+
+// Minimal stand-in for The Machinery's plugins/graph_interpreter/graph_interpreter.h.
+
+#include <foundation/api_types.h>
+
+typedef struct tm_graph_interpreter_o tm_graph_interpreter_o;
+
+typedef struct tm_graph_interpreter_wire_content_t
+{
+    uint32_t n;
+    uint32_t size;
+    void *data;
+} tm_graph_interpreter_wire_content_t;
+
+typedef struct tm_graph_interpreter_context_t
+{
+    tm_graph_interpreter_o *interpreter;
+    uint32_t node;
+    uint32_t padding;
+    const uint32_t *wires;
+    void *data;
+} tm_graph_interpreter_context_t;
+
+struct tm_graph_interpreter_api
+{
+    tm_graph_interpreter_wire_content_t (*read_wire)(tm_graph_interpreter_o *gr, uint32_t wire);
+    void *(*write_wire)(tm_graph_interpreter_o *gr, uint32_t wire, uint32_t n, uint32_t size);
+    void (*trigger_wire)(tm_graph_interpreter_o *gr, uint32_t wire);
+    tm_graph_interpreter_wire_content_t (*read_variable)(tm_graph_interpreter_o *gr, uint64_t variable);
+    void *(*write_variable)(tm_graph_interpreter_o *gr, uint64_t variable, uint32_t n, uint32_t size);
+    void (*trigger_event)(tm_graph_interpreter_o *gr, tm_strhash_t event);
+};
+
+#define tm_graph_interpreter_api_version TM_VERSION(1, 0, 0)
@@ -0,0 +1,291 @@
+// Headless benchmark for the tween plugin. Builds tween.c against the stub SDK headers in
+// bench/stubs, loads it through a minimal API registry and entity context and prints the results
+// as JSON on stdout.
+//
+// Usage: tween_bench [--max <num_tweens>] [--frames <num_frames>]
+
+#include "host.h"
+
+// Scenarios. Each one runs on a fresh manager and returns the seconds spent in the measured part.
+
+typedef struct scenario_t
+{
+    const char *name;
+    double (*run)(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations);
+} scenario_t;
+
+static tm_tween_t *handles;
+
+// Keeps the reads in `get_float_all()` from being optimized out.
+static volatile float sink;
+
+static void create_tweens(uint32_t num_tweens, float duration, bool mixed_easing)
+{
+    for (uint32_t i = 0; i < num_tweens; ++i)
+    {
+        const uint32_t easing = mixed_easing ? rng() % TM_TWEEN_EASING_ITEM_COUNT : TM_TWEEN_EASING_ITEM_LINEAR;
+        handles[i] = tween_api.create(0.0f, 1.0f, duration, easing);
+    }
+}
+
+static double create_storm(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    begin_manager();
+    const double t0 = now();
+    create_tweens(num_tweens, 1.0f, false);
+    const double t = now() - t0;
+    end_manager();
+    *iterations = num_tweens;
+    return t;
+}
+
+// `create_storm()` through one `create_many()` call.
+static double create_many_storm(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    float *from = malloc(num_tweens * sizeof(*from));
+    float *to = malloc(num_tweens * sizeof(*to));
+    float *duration = malloc(num_tweens * sizeof(*duration));
+    uint32_t *easing = malloc(num_tweens * sizeof(*easing));
+    for (uint32_t i = 0; i < num_tweens; ++i)
+    {
+        from[i] = 0.0f;
+        to[i] = 1.0f;
+        duration[i] = 1.0f;
+        easing[i] = TM_TWEEN_EASING_ITEM_LINEAR;
+    }
+
+    begin_manager();
+    const double t0 = now();
+    tween_api.create_many(from, to, duration, easing, num_tweens, (tm_strhash_t){ 0 }, handles);
+    const double t = now() - t0;
+    end_manager();
+
+    free(easing);
+    free(duration);
+    free(to);
+    free(from);
+    *iterations = num_tweens;
+    return t;
+}
+
+static double update_frames(uint32_t num_frames)
+{
+    const double t0 = now();
+    for (uint32_t f = 0; f < num_frames; ++f)
+        update();
+    return now() - t0;
+}
+
+static double steady_update(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    begin_manager();
+    create_tweens(num_tweens, 3600.0f, false);
+    update();
+    const double t = update_frames(num_frames);
+    end_manager();
+    *iterations = num_frames;
+    return t;
+}
+
+static double steady_update_cached(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    begin_manager();
+    tween_api.set_value_cache(true);
+    create_tweens(num_tweens, 3600.0f, false);
+    update();
+    const double t = update_frames(num_frames);
+    end_manager();
+    *iterations = num_frames;
+    return t;
+}
+
+static double mixed_easing_update(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    begin_manager();
+    tween_api.set_value_cache(true);
+    create_tweens(num_tweens, 3600.0f, true);
+    update();
+    const double t = update_frames(num_frames);
+    end_manager();
+    *iterations = num_frames;
+    return t;
+}
+
+// Like `mixed_easing_update()`, with a mix of CSS style custom curves instead of the built-in ones.
+static double custom_curve_update(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    static const float controls[][4] = {
+        { 0.25f, 0.1f, 0.25f, 1.0f },
+        { 0.42f, 0.0f, 1.0f, 1.0f },
+        { 0.0f, 0.0f, 0.58f, 1.0f },
+        { 0.42f, 0.0f, 0.58f, 1.0f },
+        { 0.68f, -0.55f, 0.265f, 1.55f },
+        { 0.34f, 1.56f, 0.64f, 1.0f },
+        { 0.65f, 0.0f, 0.35f, 1.0f },
+        { 0.12f, 0.0f, 0.39f, 0.0f },
+    };
+    const uint32_t num_curves = sizeof(controls) / sizeof(*controls);
+    uint32_t curves[sizeof(controls) / sizeof(*controls)];
+    for (uint32_t c = 0; c < num_curves; ++c)
+        curves[c] = tween_api.cubic_bezier(controls[c][0], controls[c][1], controls[c][2], controls[c][3]);
+
+    begin_manager();
+    tween_api.set_value_cache(true);
+    for (uint32_t i = 0; i < num_tweens; ++i)
+        handles[i] = tween_api.create(0.0f, 1.0f, 3600.0f, curves[rng() % num_curves]);
+    update();
+    const double t = update_frames(num_frames);
+    end_manager();
+    *iterations = num_frames;
+    return t;
+}
+
+// Every tween finishes within the measured frames, spread evenly over them.
+static double mass_expiry(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    begin_manager();
+    for (uint32_t i = 0; i < num_tweens; ++i)
+        handles[i] = tween_api.create(0.0f, 1.0f, (float)(delta_time * (1 + i % num_frames)), TM_TWEEN_EASING_ITEM_LINEAR);
+    const double t = update_frames(num_frames + 1);
+    end_manager();
+    *iterations = num_frames + 1;
+    return t;
+}
+
+// Idle-bob loops: yoyo tweens repeating forever with periods of a few frames to a few seconds, so
+// some of them wrap every frame.
+static double looping_update(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    begin_manager();
+    tween_api.set_value_cache(true);
+    for (uint32_t i = 0; i < num_tweens; ++i)
+    {
+        handles[i] = tween_api.create(0.0f, 1.0f, (float)(delta_time * (4 + rng() % 200)), TM_TWEEN_EASING_ITEM_INOUTSINE);
+        tween_api.set_repeat(handles[i], TM_TWEEN_REPEAT_FOREVER, TM_TWEEN_REPEAT_YOYO);
+    }
+    update();
+    const double t = update_frames(num_frames);
+    end_manager();
+    *iterations = num_frames;
+    return t;
+}
+
+static double destroy_many_all(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    begin_manager();
+    create_tweens(num_tweens, 3600.0f, true);
+    const double t0 = now();
+    tween_api.destroy_many(handles, num_tweens);
+    const double t = now() - t0;
+    end_manager();
+    *iterations = num_tweens;
+    return t;
+}
+
+static double get_float_all_with(uint32_t precision, uint32_t num_tweens, uint32_t *iterations)
+{
+    begin_manager();
+    tween_api.set_easing_precision(precision);
+    create_tweens(num_tweens, 3600.0f, true);
+    update();
+    float sum = 0.0f, v;
+    const double t0 = now();
+    for (uint32_t i = 0; i < num_tweens; ++i)
+    {
+        if (tween_api.get_float(handles[i], &v))
+            sum += v;
+    }
+    const double t = now() - t0;
+    end_manager();
+    sink = sum;
+    *iterations = num_tweens;
+    return t;
+}
+
+static double get_float_all(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    return get_float_all_with(TM_TWEEN_EASING_PRECISION_EXACT, num_tweens, iterations);
+}
+
+static double get_float_all_fast(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    return get_float_all_with(TM_TWEEN_EASING_PRECISION_FAST, num_tweens, iterations);
+}
+
+static double get_float_all_table(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    return get_float_all_with(TM_TWEEN_EASING_PRECISION_TABLE, num_tweens, iterations);
+}
+
+static double random_destroy(uint32_t num_tweens, uint32_t num_frames, uint32_t *iterations)
+{
+    begin_manager();
+    create_tweens(num_tweens, 3600.0f, true);
+    for (uint32_t i = num_tweens - 1; i > 0; --i)
+    {
+        const uint32_t j = rng() % (i + 1);
+        const tm_tween_t h = handles[i];
+        handles[i] = handles[j];
+        handles[j] = h;
+    }
+    const double t0 = now();
+    for (uint32_t i = 0; i < num_tweens / 2; ++i)
+        tween_api.destroy(handles[i]);
+    const double t = now() - t0;
+    end_manager();
+    *iterations = num_tweens / 2;
+    return t;
+}
+
+static const scenario_t scenarios[] = {
+    { "create_storm", create_storm },
+    { "create_many_storm", create_many_storm },
+    { "steady_update", steady_update },
+    { "steady_update_cached", steady_update_cached },
+    { "mixed_easing_update", mixed_easing_update },
+    { "custom_curve_update", custom_curve_update },
+    { "mass_expiry", mass_expiry },
+    { "looping_update", looping_update },
+    { "get_float_all", get_float_all },
+    { "get_float_all_fast", get_float_all_fast },
+    { "get_float_all_table", get_float_all_table },
+    { "random_destroy", random_destroy },
+    { "destroy_many_all", destroy_many_all },
+};
+
+int main(int argc, char **argv)
+{
+    uint32_t max_tweens = 1000000;
+    uint32_t num_frames = 100;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (!strcmp(argv[i], "--max"))
+            max_tweens = (uint32_t)strtoul(argv[i + 1], 0, 10);
+        else if (!strcmp(argv[i], "--frames"))
+            num_frames = (uint32_t)strtoul(argv[i + 1], 0, 10);
+    }
+    if (!num_frames)
+        num_frames = 1;
+
+    tm_load_plugin(&registry, true);
+    handles = malloc((max_tweens ? max_tweens : 1) * sizeof(*handles));
+
+    printf("{\n  \"benchmark\": \"tween\",\n  \"frames\": %u,\n  \"results\": [", num_frames);
+    bool first = true;
+    for (uint32_t n = 1000; n <= max_tweens; n *= 10)
+    {
+        for (uint32_t s = 0; s < sizeof(scenarios) / sizeof(*scenarios); ++s)
+        {
+            uint32_t iterations = 0;
+            const double t = scenarios[s].run(n, num_frames, &iterations);
+            printf("%s\n    { \"scenario\": \"%s\", \"tweens\": %u, \"iterations\": %u, \"total_ms\": %.3f, \"ms_per_iteration\": %.6f }",
+                first ? "" : ",", scenarios[s].name, n, iterations, t * 1e3, t * 1e3 / iterations);
+            first = false;
+        }
+    }
+    printf("\n  ]\n}\n");
+
+    free(handles);
+    tm_load_plugin(&registry, false);
+    return 0;
+}
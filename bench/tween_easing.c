@@ -0,0 +1,200 @@
+// Accuracy and speed report for the easing curves of easing.inl. For every built-in curve it
+// compares the single precision kernels and the tables against the `double` curves and times the
+// exact, fast, table and batch evaluation. Prints the results as JSON on stdout.
+//
+// Usage: tween_easing [--samples <log2_num_intervals>] [--reps <num_repetitions>]
+
+#include <foundation/api_types.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "../easing.inl"
+
+static double now(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER f, t;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&t);
+    return (double)t.QuadPart / (double)f.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+#endif
+}
+
+typedef struct curve_t
+{
+    const char *name;
+    double (*exact)(double);
+    easingFastFunction fast;
+    easingBatchFunction batch;
+} curve_t;
+
+#define CURVE(name) { #name, ease##name, ease##name##Fast, ease##name##Batch }
+
+static const curve_t curves[] = {
+    CURVE(Linear),
+    CURVE(InSine),
+    CURVE(OutSine),
+    CURVE(InOutSine),
+    CURVE(InQuad),
+    CURVE(OutQuad),
+    CURVE(InOutQuad),
+    CURVE(InCubic),
+    CURVE(OutCubic),
+    CURVE(InOutCubic),
+    CURVE(InQuart),
+    CURVE(OutQuart),
+    CURVE(InOutQuart),
+    CURVE(InQuint),
+    CURVE(OutQuint),
+    CURVE(InOutQuint),
+    CURVE(InExpo),
+    CURVE(OutExpo),
+    CURVE(InOutExpo),
+    CURVE(InCirc),
+    CURVE(OutCirc),
+    CURVE(InOutCirc),
+    CURVE(InBack),
+    CURVE(OutBack),
+    CURVE(InOutBack),
+    CURVE(InElastic),
+    CURVE(OutElastic),
+    CURVE(InOutElastic),
+    CURVE(InBounce),
+    CURVE(OutBounce),
+    CURVE(InOutBounce),
+};
+
+#undef CURVE
+
+// Progress values the timings cycle through, small enough to stay in L1.
+#define TIMING_VALUES 4096
+
+static float timing_t[TIMING_VALUES];
+static float timing_res[TIMING_VALUES];
+
+// Keeps the timed loops from being optimized out.
+static volatile float sink;
+
+static float table[EASING_TABLE_SIZE + 1];
+
+enum method {
+    METHOD_EXACT,
+    METHOD_FAST,
+    METHOD_TABLE,
+    METHOD_BATCH,
+};
+
+// Best of `TIMING_RUNS` runs, in seconds for `reps` passes over `timing_t`.
+#define TIMING_RUNS 5
+
+static double time_method(const curve_t *c, enum method method, uint32_t reps)
+{
+    double best = 0.0;
+    for (uint32_t run = 0; run < TIMING_RUNS; ++run)
+    {
+        float sum = 0.0f;
+        const double t0 = now();
+        for (uint32_t r = 0; r < reps; ++r)
+        {
+            switch (method)
+            {
+            case METHOD_EXACT:
+                for (uint32_t i = 0; i < TIMING_VALUES; ++i)
+                    sum += (float)c->exact(timing_t[i]);
+                break;
+            case METHOD_FAST:
+                for (uint32_t i = 0; i < TIMING_VALUES; ++i)
+                    sum += c->fast(timing_t[i]);
+                break;
+            case METHOD_TABLE:
+                for (uint32_t i = 0; i < TIMING_VALUES; ++i)
+                    sum += easeTableLookup(table, timing_t[i]);
+                break;
+            case METHOD_BATCH:
+                c->batch(timing_t, timing_res, TIMING_VALUES);
+                sum += timing_res[r % TIMING_VALUES];
+                break;
+            }
+        }
+        const double t = now() - t0;
+        sink = sum;
+        if (!run || t < best)
+            best = t;
+    }
+    return best;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t log2_intervals = 20;
+    uint32_t reps = 50;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (!strcmp(argv[i], "--samples"))
+            log2_intervals = (uint32_t)strtoul(argv[i + 1], 0, 10);
+        else if (!strcmp(argv[i], "--reps"))
+            reps = (uint32_t)strtoul(argv[i + 1], 0, 10);
+    }
+    if (log2_intervals > 26)
+        log2_intervals = 26;
+    if (!reps)
+        reps = 1;
+
+    const uint32_t num_intervals = 1u << log2_intervals;
+    float *x = malloc((num_intervals + 1) * sizeof(float));
+    float *batch = malloc((num_intervals + 1) * sizeof(float));
+    for (uint32_t i = 0; i <= num_intervals; ++i)
+        x[i] = (float)((double)i / num_intervals);
+
+    uint64_t state = 0x9e3779b97f4a7c15ULL;
+    for (uint32_t i = 0; i < TIMING_VALUES; ++i)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        timing_t[i] = (float)(state >> 40) / (float)(1 << 24);
+    }
+
+    const double num_evaluations = (double)reps * TIMING_VALUES;
+    printf("{\n  \"benchmark\": \"tween_easing\",\n  \"simd\": %s,\n  \"samples\": %u,\n  \"table_size\": %u,\n  \"results\": [",
+        TM_TWEEN_EASING_SIMD ? "true" : "false", num_intervals + 1, EASING_TABLE_SIZE);
+    for (uint32_t k = 0; k < sizeof(curves) / sizeof(*curves); ++k)
+    {
+        const curve_t *c = curves + k;
+        easeBuildTable(c->exact, table);
+        c->batch(x, batch, num_intervals + 1);
+
+        double fast_error = 0.0, table_error = 0.0, batch_error = 0.0;
+        for (uint32_t i = 0; i <= num_intervals; ++i)
+        {
+            const double ref = c->exact(x[i]);
+            fast_error = fmax(fast_error, fabs(c->fast(x[i]) - ref));
+            table_error = fmax(table_error, fabs(easeTableLookup(table, x[i]) - ref));
+            batch_error = fmax(batch_error, fabs(batch[i] - ref));
+        }
+
+        const double exact_ns = time_method(c, METHOD_EXACT, reps) * 1e9 / num_evaluations;
+        const double fast_ns = time_method(c, METHOD_FAST, reps) * 1e9 / num_evaluations;
+        const double table_ns = time_method(c, METHOD_TABLE, reps) * 1e9 / num_evaluations;
+        const double batch_ns = time_method(c, METHOD_BATCH, reps) * 1e9 / num_evaluations;
+        printf("%s\n    { \"curve\": \"%s\", \"fast_max_error\": %.3g, \"table_max_error\": %.3g, \"batch_max_error\": %.3g, "
+               "\"exact_ns\": %.3f, \"fast_ns\": %.3f, \"table_ns\": %.3f, \"batch_ns\": %.3f }",
+            k ? "," : "", c->name, fast_error, table_error, batch_error, exact_ns, fast_ns, table_ns, batch_ns);
+    }
+    printf("\n  ]\n}\n");
+
+    free(batch);
+    free(x);
+    return 0;
+}
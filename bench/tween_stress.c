@@ -0,0 +1,445 @@
+// Randomized stress test for the tween plugin. Interleaves create, destroy, pause and evaluate
+// calls with tween system updates, checks every result against a naive reference model and
+// reports the per-frame update time distribution and the slowest single calls as JSON on stdout.
+//
+// Time steps and durations are multiples of 1/64 s, so the model and the plugin agree exactly on
+// when a tween finishes and values only differ by float rounding.
+//
+// Usage: tween_stress [--frames N] [--seed N] [--max-live N] [--create R] [--destroy R]
+//                     [--pause R] [--reads R] [--burst N] [--burst-every N] [--check-every N]
+//                     [--threads N]
+//
+// Rates are calls per frame and may be fractional. `--threads` installs a scheduler running the
+// update on N threads and lowers the parallel threshold, so the parallel update, including the
+// compaction of mass expiries, is checked against the model too. Exits with 1 if any check failed.
+
+#include "host.h"
+
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+#include "../easing_curves.inl"
+
+// Scalar curves used by the model, independent of the plugin's tables.
+static double (*const easing_curves[])(double) = {
+    [TM_TWEEN_EASING_ITEM_LINEAR]       = easeLinear,
+    [TM_TWEEN_EASING_ITEM_INSINE]       = easeInSine,
+    [TM_TWEEN_EASING_ITEM_OUTSINE]      = easeOutSine,
+    [TM_TWEEN_EASING_ITEM_INOUTSINE]    = easeInOutSine,
+    [TM_TWEEN_EASING_ITEM_INQUAD]       = easeInQuad,
+    [TM_TWEEN_EASING_ITEM_OUTQUAD]      = easeOutQuad,
+    [TM_TWEEN_EASING_ITEM_INOUTQUAD]    = easeInOutQuad,
+    [TM_TWEEN_EASING_ITEM_INCUBIC]      = easeInCubic,
+    [TM_TWEEN_EASING_ITEM_OUTCUBIC]     = easeOutCubic,
+    [TM_TWEEN_EASING_ITEM_INOUTCUBIC]   = easeInOutCubic,
+    [TM_TWEEN_EASING_ITEM_INQUART]      = easeInQuart,
+    [TM_TWEEN_EASING_ITEM_OUTQUART]     = easeOutQuart,
+    [TM_TWEEN_EASING_ITEM_INOUTQUART]   = easeInOutQuart,
+    [TM_TWEEN_EASING_ITEM_INQUINT]      = easeInQuint,
+    [TM_TWEEN_EASING_ITEM_OUTQUINT]     = easeOutQuint,
+    [TM_TWEEN_EASING_ITEM_INOUTQUINT]   = easeInOutQuint,
+    [TM_TWEEN_EASING_ITEM_INEXPO]       = easeInExpo,
+    [TM_TWEEN_EASING_ITEM_OUTEXPO]      = easeOutExpo,
+    [TM_TWEEN_EASING_ITEM_INOUTEXPO]    = easeInOutExpo,
+    [TM_TWEEN_EASING_ITEM_INCIRC]       = easeInCirc,
+    [TM_TWEEN_EASING_ITEM_OUTCIRC]      = easeOutCirc,
+    [TM_TWEEN_EASING_ITEM_INOUTCIRC]    = easeInOutCirc,
+    [TM_TWEEN_EASING_ITEM_INBACK]       = easeInBack,
+    [TM_TWEEN_EASING_ITEM_OUTBACK]      = easeOutBack,
+    [TM_TWEEN_EASING_ITEM_INOUTBACK]    = easeInOutBack,
+    [TM_TWEEN_EASING_ITEM_INELASTIC]    = easeInElastic,
+    [TM_TWEEN_EASING_ITEM_OUTELASTIC]   = easeOutElastic,
+    [TM_TWEEN_EASING_ITEM_INOUTELASTIC] = easeInOutElastic,
+    [TM_TWEEN_EASING_ITEM_INBOUNCE]     = easeInBounce,
+    [TM_TWEEN_EASING_ITEM_OUTBOUNCE]    = easeOutBounce,
+    [TM_TWEEN_EASING_ITEM_INOUTBOUNCE]  = easeInOutBounce,
+};
+
+// Reference model of a tween.
+typedef struct model_tween_t
+{
+    tm_tween_t handle;
+    float from;
+    float to;
+    double duration;
+    double elapsed;
+    uint32_t easing;
+    bool paused;
+    TM_PAD(3);
+} model_tween_t;
+
+static model_tween_t *model;
+static uint32_t num_model;
+
+typedef struct options_t
+{
+    uint32_t frames;
+    uint32_t max_live;
+    double create_rate;
+    double destroy_rate;
+    double pause_rate;
+    double read_rate;
+    uint32_t burst;
+    uint32_t burst_every;
+    uint32_t check_every;
+    uint32_t threads;
+    uint64_t seed;
+} options_t;
+
+enum {
+    OP_CREATE,
+    OP_DESTROY,
+    OP_PAUSE,
+    OP_READ,
+    OP_UPDATE,
+    OP_COUNT,
+};
+
+static const char *op_names[OP_COUNT] = { "create", "destroy", "pause", "read", "update" };
+
+typedef struct op_stats_t
+{
+    uint64_t count;
+    double total;
+    double max;
+    uint32_t max_frame;
+    TM_PAD(4);
+} op_stats_t;
+
+static op_stats_t ops[OP_COUNT];
+static uint32_t frame;
+static uint64_t failures;
+
+static void record(uint32_t op, double t)
+{
+    op_stats_t *s = ops + op;
+    ++s->count;
+    s->total += t;
+    if (t > s->max)
+    {
+        s->max = t;
+        s->max_frame = frame;
+    }
+}
+
+static void fail(const char *what, const model_tween_t *m, float got)
+{
+    if (failures++ < 10)
+    {
+        fprintf(stderr, "frame %u: %s, tween %u:%u elapsed %f of %f easing %u paused %d, got %f\n", frame, what,
+            m->handle.index, m->handle.generation, m->elapsed, m->duration, m->easing, m->paused, got);
+    }
+}
+
+static float randf(float lo, float hi)
+{
+    return lo + (hi - lo) * (float)(rng() >> 8) / (float)(1 << 24);
+}
+
+// Number of calls this frame for a fractional per-frame rate.
+static uint32_t calls(double rate)
+{
+    const uint32_t n = (uint32_t)rate;
+    return n + ((double)(rng() >> 8) / (double)(1 << 24) < rate - n ? 1 : 0);
+}
+
+static double expected_value(const model_tween_t *m)
+{
+    const float t = (float)m->elapsed * (1.0f / (float)m->duration);
+    if (t >= 1.0f)
+        return m->to;
+    return m->from + (m->to - m->from) * easing_curves[m->easing](t);
+}
+
+static void create_tween(uint32_t duration_ticks)
+{
+    model_tween_t m = {
+        .from = randf(-10.0f, 10.0f),
+        .to = randf(-10.0f, 10.0f),
+        .duration = duration_ticks * delta_time,
+        .easing = rng() % TM_TWEEN_EASING_ITEM_COUNT,
+    };
+    const double t0 = now();
+    m.handle = tween_api.create(m.from, m.to, (float)m.duration, m.easing);
+    record(OP_CREATE, now() - t0);
+    model[num_model++] = m;
+}
+
+static void destroy_tween(uint32_t k)
+{
+    const double t0 = now();
+    tween_api.destroy(model[k].handle);
+    record(OP_DESTROY, now() - t0);
+
+    float v;
+    if (tween_api.get_float(model[k].handle, &v))
+        fail("destroyed tween still alive", model + k, v);
+    model[k] = model[--num_model];
+}
+
+static void pause_tween(uint32_t k)
+{
+    model_tween_t *m = model + k;
+    const double t0 = now();
+    const bool ok = tween_api.pause(m->handle, !m->paused);
+    record(OP_PAUSE, now() - t0);
+
+    if (!ok)
+        fail("pause on live tween failed", m, 0.0f);
+    m->paused = !m->paused;
+}
+
+static void read_tween(uint32_t k)
+{
+    const model_tween_t *m = model + k;
+    float v;
+    const double t0 = now();
+    const bool ok = tween_api.get_float(m->handle, &v);
+    record(OP_READ, now() - t0);
+
+    if (!ok)
+        fail("live tween not found", m, 0.0f);
+    else if (fabs(v - expected_value(m)) > 1e-4)
+        fail("value mismatch", m, v);
+}
+
+// Reads, pauses and destroys the zero handle and generation 0 handles, which free slots in the
+// reserve ring and the slots pushed when the slot table grows hold. None of them may reach a live
+// tween; the reads of the model catch any that did.
+static void probe_invalid_handles(uint32_t max_index)
+{
+    for (uint32_t n = 0; n < 4; ++n)
+    {
+        const tm_tween_t handle = { .index = n ? rng() % max_index : 0 };
+        const model_tween_t m = { .handle = handle };
+        float v;
+        if (tween_api.get_float(handle, &v))
+            fail("generation 0 handle read", &m, v);
+        if (tween_api.pause(handle, true))
+            fail("generation 0 handle paused", &m, 0.0f);
+        tween_api.destroy(handle);
+    }
+}
+
+// Mirrors the update: tweens that had finished by the previous update are removed, then time
+// advances for the ones that aren't paused.
+static void update_model(void)
+{
+    uint32_t num_removed = 0;
+    for (uint32_t k = 0; k < num_model;)
+    {
+        if (model[k].elapsed >= model[k].duration)
+        {
+            ++num_removed;
+            float v;
+            if (tween_api.get_float(model[k].handle, &v))
+                fail("finished tween not removed", model + k, v);
+            model[k] = model[--num_model];
+        }
+        else
+        {
+            ++k;
+        }
+    }
+
+    const tm_tween_t *finished;
+    if (tween_api.finished(&finished) != num_removed)
+    {
+        const model_tween_t none = { 0 };
+        fail("completion queue size differs from the model", &none, (float)tween_api.finished(&finished));
+    }
+
+    for (uint32_t k = 0; k < num_model; ++k)
+    {
+        if (!model[k].paused)
+            model[k].elapsed += delta_time;
+    }
+}
+
+// Parallel update on `num_threads` threads, the calling one included. Thread `t` runs every
+// `num_threads`th task index from `t` on, so the chunks of one call are spread over all threads.
+typedef struct stress_worker_t
+{
+    void (*task)(void *data, uint32_t i);
+    void *data;
+    uint32_t first;
+    uint32_t count;
+} stress_worker_t;
+
+#define STRESS_MAX_THREADS 64
+
+static uint32_t num_threads;
+
+#if defined(_WIN32)
+static DWORD WINAPI run_worker(void *arg)
+#else
+static void *run_worker(void *arg)
+#endif
+{
+    const stress_worker_t *w = arg;
+    for (uint32_t i = w->first; i < w->count; i += num_threads)
+        w->task(w->data, i);
+    return 0;
+}
+
+static void threaded_parallel_for(void *inst, void (*task)(void *data, uint32_t i), void *data, uint32_t count)
+{
+    stress_worker_t workers[STRESS_MAX_THREADS];
+#if defined(_WIN32)
+    HANDLE threads[STRESS_MAX_THREADS];
+#else
+    pthread_t threads[STRESS_MAX_THREADS];
+#endif
+    for (uint32_t t = 0; t < num_threads; ++t)
+        workers[t] = (stress_worker_t){ .task = task, .data = data, .first = t, .count = count };
+    for (uint32_t t = 1; t < num_threads; ++t)
+    {
+#if defined(_WIN32)
+        threads[t] = CreateThread(0, 0, run_worker, workers + t, 0, 0);
+#else
+        pthread_create(threads + t, 0, run_worker, workers + t);
+#endif
+    }
+    run_worker(workers);
+    for (uint32_t t = 1; t < num_threads; ++t)
+    {
+#if defined(_WIN32)
+        WaitForSingleObject(threads[t], INFINITE);
+        CloseHandle(threads[t]);
+#else
+        pthread_join(threads[t], 0);
+#endif
+    }
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+    const double x = *(const double *)a, y = *(const double *)b;
+    return x < y ? -1 : x > y;
+}
+
+static double percentile(const double *sorted, uint32_t n, double p)
+{
+    const uint32_t i = (uint32_t)(p * (n - 1) + 0.5);
+    return sorted[i < n ? i : n - 1];
+}
+
+int main(int argc, char **argv)
+{
+    options_t o = {
+        .frames = 10000,
+        .max_live = 20000,
+        .create_rate = 40.0,
+        .destroy_rate = 10.0,
+        .pause_rate = 5.0,
+        .read_rate = 256.0,
+        .burst = 5000,
+        .burst_every = 1000,
+        .check_every = 64,
+        .seed = 1,
+    };
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const char *a = argv[i], *v = argv[i + 1];
+        if (!strcmp(a, "--frames")) o.frames = (uint32_t)strtoul(v, 0, 10);
+        else if (!strcmp(a, "--seed")) o.seed = strtoull(v, 0, 10);
+        else if (!strcmp(a, "--max-live")) o.max_live = (uint32_t)strtoul(v, 0, 10);
+        else if (!strcmp(a, "--create")) o.create_rate = atof(v);
+        else if (!strcmp(a, "--destroy")) o.destroy_rate = atof(v);
+        else if (!strcmp(a, "--pause")) o.pause_rate = atof(v);
+        else if (!strcmp(a, "--reads")) o.read_rate = atof(v);
+        else if (!strcmp(a, "--burst")) o.burst = (uint32_t)strtoul(v, 0, 10);
+        else if (!strcmp(a, "--burst-every")) o.burst_every = (uint32_t)strtoul(v, 0, 10);
+        else if (!strcmp(a, "--check-every")) o.check_every = (uint32_t)strtoul(v, 0, 10);
+        else if (!strcmp(a, "--threads")) o.threads = (uint32_t)strtoul(v, 0, 10);
+    }
+
+    rng_state = o.seed * 0x9e3779b97f4a7c15ULL | 1;
+    delta_time = 1.0 / 64.0;
+    const uint32_t model_capacity = o.max_live + o.burst;
+    model = malloc((model_capacity ? model_capacity : 1) * sizeof(*model));
+    double *frame_times = malloc((o.frames ? o.frames : 1) * sizeof(*frame_times));
+
+    tm_load_plugin(&registry, true);
+    begin_manager();
+
+    // A threshold well below the live count sends every update through the scheduler, and bursts
+    // finish enough tweens at once to take the parallel compaction.
+    if (o.threads)
+    {
+        num_threads = o.threads < STRESS_MAX_THREADS ? o.threads : STRESS_MAX_THREADS;
+        tween_api.set_scheduler(&(tm_tween_scheduler_i){ .parallel_for = threaded_parallel_for });
+        tween_api.set_parallel_threshold(64);
+    }
+
+    uint32_t peak_live = 0;
+    for (frame = 0; frame < o.frames; ++frame)
+    {
+        for (uint32_t n = calls(o.create_rate); n && num_model < o.max_live; --n)
+            create_tween(1 + rng() % 512);
+
+        // A burst of tweens that all finish on the same frame.
+        if (o.burst_every && frame % o.burst_every == o.burst_every - 1)
+        {
+            for (uint32_t n = 0; n < o.burst && num_model < model_capacity; ++n)
+                create_tween(64);
+        }
+
+        for (uint32_t n = calls(o.destroy_rate); n && num_model; --n)
+            destroy_tween(rng() % num_model);
+
+        for (uint32_t n = calls(o.pause_rate); n && num_model; --n)
+            pause_tween(rng() % num_model);
+
+        probe_invalid_handles(2 * model_capacity);
+
+        // Toggling the value cache switches reads between the batch kernels and the scalar curves.
+        if (frame % 2000 == 1999)
+            tween_api.set_value_cache(frame % 4000 == 1999);
+
+        const double t0 = now();
+        update();
+        frame_times[frame] = now() - t0;
+        record(OP_UPDATE, frame_times[frame]);
+
+        update_model();
+        peak_live = num_model > peak_live ? num_model : peak_live;
+
+        if (o.check_every && frame % o.check_every == 0)
+        {
+            for (uint32_t k = 0; k < num_model; ++k)
+                read_tween(k);
+        }
+        for (uint32_t n = calls(o.read_rate); n && num_model; --n)
+            read_tween(rng() % num_model);
+    }
+
+    end_manager();
+    tm_load_plugin(&registry, false);
+
+    qsort(frame_times, o.frames, sizeof(*frame_times), compare_doubles);
+    const uint32_t n = o.frames ? o.frames : 1;
+
+    uint32_t worst = 0;
+    for (uint32_t op = 0; op < OP_UPDATE; ++op)
+        worst = ops[op].max > ops[worst].max ? op : worst;
+
+    printf("{\n  \"benchmark\": \"tween_stress\",\n  \"frames\": %u,\n  \"seed\": %llu,\n  \"threads\": %u,\n  \"peak_live\": %u,\n  \"failures\": %llu,\n",
+        o.frames, (unsigned long long)o.seed, num_threads, peak_live, (unsigned long long)failures);
+    printf("  \"update_ms\": { \"p50\": %.4f, \"p99\": %.4f, \"p99_9\": %.4f, \"max\": %.4f, \"mean\": %.4f },\n",
+        percentile(frame_times, n, 0.5) * 1e3, percentile(frame_times, n, 0.99) * 1e3, percentile(frame_times, n, 0.999) * 1e3,
+        frame_times[n - 1] * 1e3, ops[OP_UPDATE].total / n * 1e3);
+    printf("  \"worst_op\": { \"op\": \"%s\", \"frame\": %u, \"us\": %.3f },\n", op_names[worst], ops[worst].max_frame, ops[worst].max * 1e6);
+    printf("  \"ops\": [");
+    for (uint32_t op = 0; op < OP_COUNT; ++op)
+    {
+        printf("%s\n    { \"op\": \"%s\", \"count\": %llu, \"mean_us\": %.4f, \"max_us\": %.3f, \"max_frame\": %u }", op ? "," : "",
+            op_names[op], (unsigned long long)ops[op].count, ops[op].count ? ops[op].total / ops[op].count * 1e6 : 0.0, ops[op].max * 1e6, ops[op].max_frame);
+    }
+    printf("\n  ]\n}\n");
+
+    free(frame_times);
+    free(model);
+    return failures ? 1 : 0;
+}
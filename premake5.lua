@@ -37,6 +37,7 @@ filter { "system:windows", "options:clang" }
     buildoptions {
         "-fms-extensions",                   -- Allow anonymous struct as C inheritance.
         "-mavx",                             -- AVX.
+        "-mavx2",                            -- AVX2.
         "-mfma",                             -- FMA.
     }
     removeflags {"FatalLinkWarnings"}        -- clang linker doesn't understand /WX
@@ -63,7 +64,7 @@ filter "platforms:Win64"
         "4702", -- Unreachable code. We sometimes want return after exit() because otherwise we get an error about no return value.
     }
     linkoptions {"/ignore:4099"}
-    buildoptions {"/utf-8"}     
+    buildoptions {"/utf-8", "/arch:AVX2"}     
 
 filter {"platforms:Linux"}
     defines { "TM_OS_LINUX", "TM_OS_POSIX" }
@@ -74,6 +75,7 @@ filter {"platforms:Linux"}
         "-fms-extensions",                   -- Allow anonymous struct as C inheritance.
         "-g",                                -- Debugging.
         "-mavx",                             -- AVX.
+        "-mavx2",                            -- AVX2.
         "-mfma",                             -- FMA.
         "-fcommon",                          -- Allow tentative definitions
     }
@@ -102,3 +104,55 @@ project "tween"
     language "C++"
     files {"*.inl", "*.h", "*.c"}
     sysincludedirs { "" }
+
+-- Headless benchmark, builds tween.c against the stub SDK headers in bench/stubs so it runs without
+-- The Machinery. Prints its results as JSON, see bench/tween_bench.c.
+project "tween_bench"
+    location "build/tween_bench"
+    targetname "tween_bench"
+    kind "ConsoleApp"
+    language "C"
+    files {"tween.c", "easing.inl", "easing_curves.inl", "tween.h", "bench/host.h", "bench/tween_bench.c", "bench/stubs/**.h", "bench/stubs/**.inl"}
+    removeincludedirs { "$(TM_SDK_DIR)/headers" }
+    removelibdirs { "$(TM_SDK_DIR)/lib/" .. _ACTION .. "/%{cfg.buildcfg}" }
+    includedirs { "bench/stubs" }
+
+    -- The stub carray macros leave values unused, and tween.c needs libm.
+    filter "platforms:Linux"
+        disablewarnings { "unused-value" }
+        links { "m" }
+    filter {}
+
+-- Randomized stress run checked against a reference model, reports update and operation tail
+-- latencies as JSON. Exits with 1 if the plugin disagrees with the model, see bench/tween_stress.c.
+project "tween_stress"
+    location "build/tween_stress"
+    targetname "tween_stress"
+    kind "ConsoleApp"
+    language "C"
+    files {"tween.c", "easing.inl", "easing_curves.inl", "tween.h", "bench/host.h", "bench/tween_stress.c", "bench/stubs/**.h", "bench/stubs/**.inl"}
+    removeincludedirs { "$(TM_SDK_DIR)/headers" }
+    removelibdirs { "$(TM_SDK_DIR)/lib/" .. _ACTION .. "/%{cfg.buildcfg}" }
+    includedirs { "bench/stubs" }
+
+    -- The stub carray macros leave values unused, tween.c needs libm and `--threads` pthreads.
+    filter "platforms:Linux"
+        disablewarnings { "unused-value" }
+        links { "m", "pthread" }
+    filter {}
+
+-- Accuracy and speed of the fast and table easing modes against the exact curves of easing.inl,
+-- printed as JSON, see bench/tween_easing.c.
+project "tween_easing"
+    location "build/tween_easing"
+    targetname "tween_easing"
+    kind "ConsoleApp"
+    language "C"
+    files {"easing.inl", "easing_curves.inl", "bench/tween_easing.c", "bench/stubs/foundation/api_types.h"}
+    removeincludedirs { "$(TM_SDK_DIR)/headers" }
+    removelibdirs { "$(TM_SDK_DIR)/lib/" .. _ACTION .. "/%{cfg.buildcfg}" }
+    includedirs { "bench/stubs" }
+
+    filter "platforms:Linux"
+        links { "m" }
+    filter {}
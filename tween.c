@@ -5,6 +5,9 @@ static struct tm_graph_interpreter_api* tm_graph_interpreter_api;
 static struct tm_properties_view_api* tm_properties_view_api;
 static struct tm_the_truth_api* tm_the_truth_api;
 static struct tm_localizer_api *tm_localizer_api;
+static struct tm_job_system_api *tm_job_system_api;
+static struct tm_temp_allocator_api *tm_temp_allocator_api;
+static struct tm_profiler_api *tm_profiler_api;
 static struct tm_allocator_api *tm_allocator_api;
 
 #include "tween.h"
@@ -16,9 +19,14 @@ static struct tm_allocator_api *tm_allocator_api;
 #include <foundation/log.h>
 #include <foundation/localizer.h>
 #include <foundation/allocator.h>
+#include <foundation/atomics.inl>
 #include <foundation/carray.inl>
+#include <foundation/job_system.h>
+#include <foundation/profiler.h>
+#include <foundation/temp_allocator.h>
 
 #include <plugins/entity/entity.h>
+#include <plugins/entity/transform_component.h>
 #include <plugins/editor_views/properties.h>
 #include <plugins/editor_views/graph.h>
 #include <plugins/graph_interpreter/graph_component.h>
@@ -65,541 +73,4340 @@ static easingFunction easingFunctions[] = {
     [TM_TWEEN_EASING_ITEM_INOUTBOUNCE]  = easeInOutBounce,
 };
 
+static easingBatchFunction easingBatchFunctions[] = {
+    [TM_TWEEN_EASING_ITEM_LINEAR]       = easeLinearBatch,
+    [TM_TWEEN_EASING_ITEM_INSINE]       = easeInSineBatch,
+    [TM_TWEEN_EASING_ITEM_OUTSINE]      = easeOutSineBatch,
+    [TM_TWEEN_EASING_ITEM_INOUTSINE]    = easeInOutSineBatch,
+    [TM_TWEEN_EASING_ITEM_INQUAD]       = easeInQuadBatch,
+    [TM_TWEEN_EASING_ITEM_OUTQUAD]      = easeOutQuadBatch,
+    [TM_TWEEN_EASING_ITEM_INOUTQUAD]    = easeInOutQuadBatch,
+    [TM_TWEEN_EASING_ITEM_INCUBIC]      = easeInCubicBatch,
+    [TM_TWEEN_EASING_ITEM_OUTCUBIC]     = easeOutCubicBatch,
+    [TM_TWEEN_EASING_ITEM_INOUTCUBIC]   = easeInOutCubicBatch,
+    [TM_TWEEN_EASING_ITEM_INQUART]      = easeInQuartBatch,
+    [TM_TWEEN_EASING_ITEM_OUTQUART]     = easeOutQuartBatch,
+    [TM_TWEEN_EASING_ITEM_INOUTQUART]   = easeInOutQuartBatch,
+    [TM_TWEEN_EASING_ITEM_INQUINT]      = easeInQuintBatch,
+    [TM_TWEEN_EASING_ITEM_OUTQUINT]     = easeOutQuintBatch,
+    [TM_TWEEN_EASING_ITEM_INOUTQUINT]   = easeInOutQuintBatch,
+    [TM_TWEEN_EASING_ITEM_INEXPO]       = easeInExpoBatch,
+    [TM_TWEEN_EASING_ITEM_OUTEXPO]      = easeOutExpoBatch,
+    [TM_TWEEN_EASING_ITEM_INOUTEXPO]    = easeInOutExpoBatch,
+    [TM_TWEEN_EASING_ITEM_INCIRC]       = easeInCircBatch,
+    [TM_TWEEN_EASING_ITEM_OUTCIRC]      = easeOutCircBatch,
+    [TM_TWEEN_EASING_ITEM_INOUTCIRC]    = easeInOutCircBatch,
+    [TM_TWEEN_EASING_ITEM_INBACK]       = easeInBackBatch,
+    [TM_TWEEN_EASING_ITEM_OUTBACK]      = easeOutBackBatch,
+    [TM_TWEEN_EASING_ITEM_INOUTBACK]    = easeInOutBackBatch,
+    [TM_TWEEN_EASING_ITEM_INELASTIC]    = easeInElasticBatch,
+    [TM_TWEEN_EASING_ITEM_OUTELASTIC]   = easeOutElasticBatch,
+    [TM_TWEEN_EASING_ITEM_INOUTELASTIC] = easeInOutElasticBatch,
+    [TM_TWEEN_EASING_ITEM_INBOUNCE]     = easeInBounceBatch,
+    [TM_TWEEN_EASING_ITEM_OUTBOUNCE]    = easeOutBounceBatch,
+    [TM_TWEEN_EASING_ITEM_INOUTBOUNCE]  = easeInOutBounceBatch,
+};
+
+static easingFastFunction easingFastFunctions[] = {
+    [TM_TWEEN_EASING_ITEM_LINEAR]       = easeLinearFast,
+    [TM_TWEEN_EASING_ITEM_INSINE]       = easeInSineFast,
+    [TM_TWEEN_EASING_ITEM_OUTSINE]      = easeOutSineFast,
+    [TM_TWEEN_EASING_ITEM_INOUTSINE]    = easeInOutSineFast,
+    [TM_TWEEN_EASING_ITEM_INQUAD]       = easeInQuadFast,
+    [TM_TWEEN_EASING_ITEM_OUTQUAD]      = easeOutQuadFast,
+    [TM_TWEEN_EASING_ITEM_INOUTQUAD]    = easeInOutQuadFast,
+    [TM_TWEEN_EASING_ITEM_INCUBIC]      = easeInCubicFast,
+    [TM_TWEEN_EASING_ITEM_OUTCUBIC]     = easeOutCubicFast,
+    [TM_TWEEN_EASING_ITEM_INOUTCUBIC]   = easeInOutCubicFast,
+    [TM_TWEEN_EASING_ITEM_INQUART]      = easeInQuartFast,
+    [TM_TWEEN_EASING_ITEM_OUTQUART]     = easeOutQuartFast,
+    [TM_TWEEN_EASING_ITEM_INOUTQUART]   = easeInOutQuartFast,
+    [TM_TWEEN_EASING_ITEM_INQUINT]      = easeInQuintFast,
+    [TM_TWEEN_EASING_ITEM_OUTQUINT]     = easeOutQuintFast,
+    [TM_TWEEN_EASING_ITEM_INOUTQUINT]   = easeInOutQuintFast,
+    [TM_TWEEN_EASING_ITEM_INEXPO]       = easeInExpoFast,
+    [TM_TWEEN_EASING_ITEM_OUTEXPO]      = easeOutExpoFast,
+    [TM_TWEEN_EASING_ITEM_INOUTEXPO]    = easeInOutExpoFast,
+    [TM_TWEEN_EASING_ITEM_INCIRC]       = easeInCircFast,
+    [TM_TWEEN_EASING_ITEM_OUTCIRC]      = easeOutCircFast,
+    [TM_TWEEN_EASING_ITEM_INOUTCIRC]    = easeInOutCircFast,
+    [TM_TWEEN_EASING_ITEM_INBACK]       = easeInBackFast,
+    [TM_TWEEN_EASING_ITEM_OUTBACK]      = easeOutBackFast,
+    [TM_TWEEN_EASING_ITEM_INOUTBACK]    = easeInOutBackFast,
+    [TM_TWEEN_EASING_ITEM_INELASTIC]    = easeInElasticFast,
+    [TM_TWEEN_EASING_ITEM_OUTELASTIC]   = easeOutElasticFast,
+    [TM_TWEEN_EASING_ITEM_INOUTELASTIC] = easeInOutElasticFast,
+    [TM_TWEEN_EASING_ITEM_INBOUNCE]     = easeInBounceFast,
+    [TM_TWEEN_EASING_ITEM_OUTBOUNCE]    = easeOutBounceFast,
+    [TM_TWEEN_EASING_ITEM_INOUTBOUNCE]  = easeInOutBounceFast,
+};
+
+// Tables of the built-in curves for `TM_TWEEN_EASING_PRECISION_TABLE`, built on plugin load.
+static float easingTables[TM_TWEEN_EASING_ITEM_COUNT][EASING_TABLE_SIZE + 1];
+
+static void build_easing_tables(void)
+{
+    for (uint32_t k = 0; k < TM_TWEEN_EASING_ITEM_COUNT; ++k)
+        easeBuildTable(easingFunctions[k], easingTables[k]);
+}
+
+// CUSTOM CURVES
+
+// Number of table entries per curve segment, see `tween_curve_segment_t`.
+#define TWEEN_CURVE_TABLE_SIZE 33
+
+// Newton steps refining the table guess. These always run, so evaluation doesn't branch on the
+// curve; two are enough except near flat spots of x(s), see `refine_curve_parameter()`.
+#define TWEEN_CURVE_NEWTON_STEPS 2
+
+// Most steps of `refine_curve_parameter()`.
+#define TWEEN_CURVE_MAX_STEPS 16
+
+// Refinement stops once the eased progress is within this of the exact value, as estimated from
+// the progress error and the slope of the curve.
+#define TWEEN_CURVE_TOLERANCE 2e-7f
+
+// Cubic Bezier segment of a baked curve. Progress is normalized to [0, 1] over the segment, so the
+// table is indexed directly.
+typedef struct tween_curve_segment_t
+{
+    // Progress at the start of the segment and the inverse of its width.
+    float x0;
+    float inv_width;
+
+    // Normalized progress x(s) = ((ax * s + bx) * s + cx) * s and eased progress
+    // y(s) = ((ay * s + by) * s + cy) * s + y0 for the curve parameter s in [0, 1].
+    float ax, bx, cx;
+    float ay, by, cy, y0;
+
+    // Curve parameter at normalized progress `k / (TWEEN_CURVE_TABLE_SIZE - 1)`.
+    float s_at_x[TWEEN_CURVE_TABLE_SIZE];
+
+    // Set if x(s) is so flat at the start or end that s(x) is closer to a square root than to a
+    // line over the first or last table interval.
+    bool flat_start;
+    bool flat_end;
+    TM_PAD(2);
+} tween_curve_segment_t;
+
+// A baked curve, allocated in one block of `bytes` with its segments and a copy of its sorted
+// points, which `bake_curve()` compares to share identical curves.
+typedef struct tween_curve_t
+{
+    uint64_t hash;
+    uint64_t bytes;
+    tween_curve_segment_t *segments;
+    tm_tween_curve_point_t *points;
+    uint32_t num_segments;
+    uint32_t num_points;
+
+    // Truth curve object the curve was compiled from, see `compile_easing_item()`. Such curves are
+    // never shared with `bake_curve()`, since an edit of the object replaces them.
+    const tm_the_truth_o *owner_tt;
+    tm_tt_id_t owner;
+
+    // Next curve in `retired_curves`.
+    struct tween_curve_t *next_retired;
+} tween_curve_t;
+
+// Curves baked by `bake_curve()`, shared by every manager and never modified once published.
+// Bakes hold `curves_lock`. `curves[i]` is written before `num_curves` is raised past `i`, so
+// readers take no lock. The slot of a Truth curve gets the new bake when the object is edited,
+// readers may still hold the old one, so it is retired and only freed when the plugin unloads.
+static tween_curve_t *curves[TM_TWEEN_MAX_CURVES];
+static atomic_uint32_t num_curves;
+static atomic_uint64_t curves_lock;
+static tween_curve_t *retired_curves;
+
+// FNV-1a over `size` bytes.
+static uint64_t hash_bytes(const void *data, uint64_t size)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (uint64_t b = 0; b < size; ++b)
+        h = (h ^ p[b]) * 0x100000001b3ULL;
+    return h;
+}
+
+static inline float clamp_float(float x, float lo, float hi)
+{
+    return x > lo ? (x < hi ? x : hi) : lo;
+}
+
+static inline float segment_x(const tween_curve_segment_t *seg, float s)
+{
+    return ((seg->ax * s + seg->bx) * s + seg->cx) * s;
+}
+
+static inline float segment_dx(const tween_curve_segment_t *seg, float s)
+{
+    return (3.0f * seg->ax * s + 2.0f * seg->bx) * s + seg->cx;
+}
+
+static inline float segment_dy(const tween_curve_segment_t *seg, float s)
+{
+    return (3.0f * seg->ay * s + 2.0f * seg->by) * s + seg->cy;
+}
+
+// True if s, where x(s) misses the target by `err`, is close enough to the root. An error in x
+// shows up in y scaled by the slope y'(s) / x'(s).
+static inline bool curve_parameter_converged(const tween_curve_segment_t *seg, float s, float err)
+{
+    return fabsf(err * segment_dy(seg, s)) < TWEEN_CURVE_TOLERANCE * segment_dx(seg, s);
+}
+
+// Bakes the segment from `a` to `b`, where `a->x < b->x`.
+static void bake_segment(tween_curve_segment_t *seg, const tm_tween_curve_point_t *a, const tm_tween_curve_point_t *b)
+{
+    // With both handles inside the segment, x(s) never decreases.
+    const float inv_width = 1.0f / (b->x - a->x);
+    const float x1 = (clamp_float(a->out_x, a->x, b->x) - a->x) * inv_width;
+    const float x2 = (clamp_float(b->in_x, a->x, b->x) - a->x) * inv_width;
+
+    seg->x0 = a->x;
+    seg->inv_width = inv_width;
+    seg->cx = 3.0f * x1;
+    seg->bx = 3.0f * (x2 - x1) - seg->cx;
+    seg->ax = 1.0f - seg->cx - seg->bx;
+    seg->cy = 3.0f * (a->out_y - a->y);
+    seg->by = 3.0f * (b->in_y - a->out_y) - seg->cy;
+    seg->ay = b->y - a->y - seg->cy - seg->by;
+    seg->y0 = a->y;
+
+    // Bisection, slow but exact, as this runs once per curve.
+    for (uint32_t k = 0; k < TWEEN_CURVE_TABLE_SIZE; ++k)
+    {
+        const float x = (float)k / (TWEEN_CURVE_TABLE_SIZE - 1);
+        float lo = 0.0f, hi = 1.0f;
+        for (uint32_t step = 0; step < 32; ++step)
+        {
+            const float mid = 0.5f * (lo + hi);
+            if (segment_x(seg, mid) < x)
+                lo = mid;
+            else
+                hi = mid;
+        }
+        seg->s_at_x[k] = 0.5f * (lo + hi);
+    }
+    seg->s_at_x[0] = 0.0f;
+    seg->s_at_x[TWEEN_CURVE_TABLE_SIZE - 1] = 1.0f;
+
+    // Compares the first and second order terms of x(s) over the end intervals.
+    const float d0 = seg->s_at_x[1];
+    const float d1 = 1.0f - seg->s_at_x[TWEEN_CURVE_TABLE_SIZE - 2];
+    seg->flat_start = seg->cx < fabsf(seg->bx) * d0;
+    seg->flat_end = segment_dx(seg, 1.0f) < fabsf(3.0f * seg->ax + seg->bx) * d1;
+}
+
+// Solves x(s) = u for s in `[lo, hi]`, starting from `s`, with Newton steps that bisect the bracket
+// instead when they would leave it. Only needed where the curve is close to vertical, which takes
+// Newton more steps and float precision may not resolve; it stops once `s` no longer moves.
+static float refine_curve_parameter(const tween_curve_segment_t *seg, float u, float lo, float hi, float s)
+{
+    for (uint32_t step = 0; step < TWEEN_CURVE_MAX_STEPS; ++step)
+    {
+        const float err = segment_x(seg, s) - u;
+        if (err == 0.0f || curve_parameter_converged(seg, s, err))
+            break;
+        if (err < 0.0f)
+            lo = s;
+        else
+            hi = s;
+
+        const float next = s - err / segment_dx(seg, s);
+        const float prev = s;
+        s = next > lo && next < hi ? next : 0.5f * (lo + hi);
+        if (s == prev)
+            break;
+    }
+    return s;
+}
+
+// Evaluates `curve` at progress `x`. Progress outside the points is clamped to the first or last
+// point.
+static float sample_curve(const tween_curve_t *curve, float x)
+{
+    const tween_curve_segment_t *seg = curve->segments;
+    const tween_curve_segment_t *last = seg + curve->num_segments - 1;
+    while (seg < last && x >= seg[1].x0)
+        ++seg;
+
+    const float u = clamp_float((x - seg->x0) * seg->inv_width, 0.0f, 1.0f);
+
+    // x(s) never decreases, so the root lies between the table entries around `u`. Newton steps
+    // are clamped to them, a zero derivative included.
+    const float f = u * (TWEEN_CURVE_TABLE_SIZE - 1);
+    const uint32_t k = f < TWEEN_CURVE_TABLE_SIZE - 2 ? (uint32_t)f : TWEEN_CURVE_TABLE_SIZE - 2;
+    const float lo = seg->s_at_x[k];
+    const float hi = seg->s_at_x[k + 1];
+    float t = f - (float)k;
+    if (k == 0 && seg->flat_start)
+        t = sqrtf(t);
+    else if (k == TWEEN_CURVE_TABLE_SIZE - 2 && seg->flat_end)
+        t = 1.0f - sqrtf(1.0f - t);
+    float s = lo + (hi - lo) * t;
+    for (uint32_t step = 0; step < TWEEN_CURVE_NEWTON_STEPS; ++step)
+        s = clamp_float(s - (segment_x(seg, s) - u) / segment_dx(seg, s), lo, hi);
+    if (!curve_parameter_converged(seg, s, segment_x(seg, s) - u))
+        s = refine_curve_parameter(seg, u, lo, hi, s);
+
+    return ((seg->ay * s + seg->by) * s + seg->cy) * s + seg->y0;
+}
+
+// Set in `tm_tween_manager_o->easing` while a yoyo tween plays backwards. Above every valid easing,
+// so only the dense arrays ever hold it.
+#define TWEEN_EASING_REVERSED 0x8000
+
+static inline const tween_curve_t *custom_curve(uint32_t easing)
+{
+    return curves[(easing & ~TWEEN_EASING_REVERSED) - TM_TWEEN_EASING_CUSTOM];
+}
+
+// Returns `easing` if it selects a built-in or baked curve, otherwise linear.
+static uint32_t valid_easing(uint32_t easing)
+{
+    if (easing < TM_TWEEN_EASING_ITEM_COUNT)
+        return easing;
+    if (easing >= TM_TWEEN_EASING_CUSTOM && easing - TM_TWEEN_EASING_CUSTOM < atomic_load_uint32_t(&num_curves))
+        return easing;
+    return TM_TWEEN_EASING_ITEM_LINEAR;
+}
+
+// Evaluates the valid easing `easing` at `t`, with a `tm_tween_easing_precision` for built-in
+// curves.
+static inline float ease_value(uint32_t easing, uint32_t precision, float t)
+{
+    if (easing >= TM_TWEEN_EASING_ITEM_COUNT)
+        return sample_curve(custom_curve(easing), t);
+
+    switch (precision)
+    {
+    case TM_TWEEN_EASING_PRECISION_FAST:
+        return easingFastFunctions[easing](t);
+    case TM_TWEEN_EASING_PRECISION_TABLE:
+        return easeTableLookup(easingTables[easing], t);
+    default:
+        return (float)easingFunctions[easing](t);
+    }
+}
+
 // SYSTEM
-struct tm_tween_item_o
+typedef struct tween_slot_t
+{
+    uint32_t generation;
+
+    // Index into the tween arrays while the slot is in use, index of the next free slot otherwise.
+    uint32_t index;
+
+    // Position in the `deadlines` of the tween's group, or `TWEEN_NO_SLOT` while the tween is paused.
+    uint32_t heap_index;
+
+    // Index in `tm_tween_manager_o->vectors` for vector tweens, `TWEEN_NO_SLOT` for float tweens.
+    uint32_t vector;
+
+    // Index in `tm_tween_manager_o->playheads` for timeline tweens, `TWEEN_NO_SLOT` otherwise.
+    uint32_t playhead;
+
+    // First of the tweens waiting for this one to finish, in `tm_tween_manager_o->successors`.
+    uint32_t first_successor;
+
+    // Number of tweens this one waits for. It is paused while this is non-zero.
+    uint32_t waiting;
+
+    // Set by `tm_tween_api->pause()`. The tween plays while this is clear and `waiting` is zero.
+    bool paused;
+    TM_PAD(3);
+
+    // Exact duration, `inv_duration` is rounded and would move the deadline of a resumed tween.
+    float duration;
+
+    // Cycles left to play after the current one, see `tm_tween_api->set_repeat()`.
+    uint32_t repeats;
+
+    // A `tm_tween_repeat_mode`.
+    uint32_t repeat_mode;
+} tween_slot_t;
+
+// Link in the list of tweens waiting for a tween, see `tm_tween_api->then()`.
+typedef struct tween_successor_t
+{
+    tm_tween_t tween;
+
+    // Next link in the list, or next free link while the link is free.
+    uint32_t next;
+    TM_PAD(4);
+} tween_successor_t;
+
+enum {
+    TWEEN_COMMAND__CREATE,
+    TWEEN_COMMAND__DESTROY,
+    TWEEN_COMMAND__PAUSE,
+};
+
+// Cell of the command queue, see `claim_command()`.
+typedef struct tween_command_t
 {
+    // Queue position of the enqueue allowed to write the cell while it is free, that position + 1
+    // once the command is written.
+    atomic_uint64_t sequence;
+
+    tm_tween_t tween;
     float from;
     float to;
     float duration;
-    float elapsed;
-    easingFunction easing;
+    uint16_t easing;
+    uint8_t type;
+    bool paused;
+} tween_command_t;
+
+// Value of the tween in a slot, as published in a snapshot.
+typedef struct tween_snapshot_entry_t
+{
+    // Generation of the tween when the snapshot was taken, 0 if the slot held none.
+    uint32_t generation;
+    TM_PAD(4);
+    float value[4];
+} tween_snapshot_entry_t;
+
+// One of the two snapshot buffers, see `publish_snapshot()`.
+typedef struct tween_snapshot_t
+{
+    // Indexed by slot.
+    tween_snapshot_entry_t *entries;
+
+    // Readers that entered the buffer while it was published, set when it is unpublished, and
+    // readers that have left it. The update only rewrites the buffer while the two match.
+    uint32_t ingress;
+    atomic_uint32_t egress;
+} tween_snapshot_t;
+
+// Endpoints of a vector tween. The tween itself goes from 0 to 1 in the tween arrays, so its
+// evaluated value is the eased progress used to interpolate between these.
+typedef struct tween_vector_t
+{
+    float from[4];
+    float to[4];
+
+    // A `tm_tween_value_type`.
+    uint32_t type;
+
+    // Index of the next free entry while the entry is free.
+    uint32_t next_free;
+} tween_vector_t;
+
+// A compiled timeline, spanning `[first_key, first_key + num_keys)` in
+// `tm_tween_manager_o->keyframes`. Never modified once compiled.
+typedef struct tween_timeline_t
+{
+    // Hash of the keyframes, to share timelines compiled from identical keyframes.
+    uint64_t hash;
+    uint32_t first_key;
+    uint32_t num_keys;
+} tween_timeline_t;
+
+// Playback state of a timeline tween. The tween itself goes linearly from 0 to the time of the
+// last keyframe, so its evaluated value is the playhead.
+typedef struct tween_playhead_t
+{
+    uint32_t timeline;
+
+    // Keyframe starting the segment the playhead was in at the last update.
+    uint32_t cursor;
+
+    // Slot of the tween, `TWEEN_NO_SLOT` while the entry is free.
+    uint32_t slot;
+
+    // Index of the next free entry while the entry is free.
+    uint32_t next_free;
+} tween_playhead_t;
+
+typedef struct tween_deadline_t
+{
+    // Group time at which the tween finishes.
+    double time;
+    uint32_t slot;
+    TM_PAD(4);
+} tween_deadline_t;
+
+// Tweens are timed by the clock of their group. Groups form a tree under the root group (index 0,
+// zero name) and are stored parents first, so the clocks can be advanced in one pass. Pausing or
+// rescaling a group only changes how fast its clock advances, whatever the number of tweens.
+typedef struct tween_group_t
+{
+    tm_strhash_t name;
+    uint32_t parent;
+
+    float time_scale;
+    bool paused;
+    TM_PAD(3);
+
+    // Time scale relative to the update time step, zero if the group or an ancestor is paused.
+    float effective_scale;
+
+    // Sum of the scaled update time steps.
+    double time;
+
+    // Binary min-heap on finish time of the group's unpaused tweens, so that an update only touches
+    // the tweens that actually finish.
+    tween_deadline_t *deadlines;
+} tween_group_t;
+
+#define TWEEN_MAX_GROUPS (UINT16_MAX + 1)
+
+#define TWEEN_NO_SLOT UINT32_MAX
+
+// Number of cells in the command queue, a power of two. Enqueues fail while this many commands
+// wait for the next update.
+#define TWEEN_COMMAND_QUEUE_SIZE 8192
+
+// Number of free slots kept ready for `reserve_handle()`.
+#define TWEEN_RESERVE_RING_SIZE 1024
+
+// Number of tweens per parallel work item. A multiple of 64 so chunks own whole `paused` words.
+#define TWEEN_CHUNK_SIZE 4096
+
+// Default for `tm_tween_manager_o->parallel_threshold`.
+#define TWEEN_DEFAULT_PARALLEL_THRESHOLD 32768
+
+// The parallel update compacts all arrays at once when at least `num_tweens / 64` tweens finished
+// in the same frame; fewer are cheaper to remove one by one.
+#define TWEEN_COMPACTION_DIVISOR 64
+
+// Tweens with custom curves share the bucket after those of the built-in curves.
+#define TWEEN_BUCKET_CUSTOM TM_TWEEN_EASING_ITEM_COUNT
+#define TWEEN_NUM_BUCKETS (TM_TWEEN_EASING_ITEM_COUNT + 1)
+
+static inline uint32_t bucket_of(uint32_t easing)
+{
+    easing &= ~TWEEN_EASING_REVERSED;
+    return easing < TM_TWEEN_EASING_ITEM_COUNT ? easing : TWEEN_BUCKET_CUSTOM;
+}
+
+// Tweens are stored as parallel arrays indexed by the same dense index. Time is not stored per
+// tween: each tween keeps the group time it started at and its progress is derived from the group
+// clock, so advancing time writes nothing per tween.
+typedef struct tween_arrays_t
+{
+    // All arrays share one allocation starting at `start`, see `carve_arrays()`.
+    //
+    // Group time at which the tween started. While the tween is paused, holds minus the elapsed
+    // time instead, so that `elapsed = (paused ? 0 : time) - start` in both cases and pause and
+    // resume just shift it by `time`. Doubles, since a float clock loses millisecond precision
+    // after a few hours.
+    double *start;
+
+    // Index in `tm_tween_manager_o->groups`.
+    uint16_t *group;
+
+    // 1 / duration, or INFINITY for zero or negative durations. Progress is `elapsed * inv_duration`,
+    // which is NaN for such tweens at `elapsed == 0`, so finished checks are written as
+    // `!(progress < 1.0f)` to treat them as finished right away.
+    float *inv_duration;
+
+    // Bitset, one bit per tween.
+    uint64_t *paused;
+
+    float *from;
+    float *to;
+
+    // Easing of each tween, with `TWEEN_EASING_REVERSED` set while it plays backwards.
+    uint16_t *easing;
+
+    // Handle of each tween, used to patch its slot when the tween moves.
+    tm_tween_t *handle;
+
+    // Eased value of each tween as of the last update, only maintained while `cache_values` is set.
+    float *values;
+} tween_arrays_t;
+
+// Lookups counted into `tm_tween_stats_t`. The binding engines may run on other threads than the
+// API callers, so each keeps its own counters, summed when the stats are published.
+typedef struct tween_lookup_counters_t
+{
+    uint32_t lookups;
+    uint32_t misses;
+} tween_lookup_counters_t;
+
+enum {
+    TWEEN_COUNTERS__API,
+    TWEEN_COUNTERS__TRANSFORM_ENGINE,
+    TWEEN_COUNTERS__MEMBER_ENGINE,
+    TWEEN_COUNTERS__COUNT,
+};
+
+// Per-frame scratch for the parallel update, see `update_parallel()`.
+typedef struct tween_update_job_t
+{
+    struct tm_tween_manager_o *manager;
+    uint32_t num_chunks;
+
+    // Bit per tween, set for the tweens that finished this frame while they are compacted away.
+    uint64_t *expired;
+
+    // Number of finished tweens in each chunk, then (after the prefix sum) before each chunk.
+    uint32_t *finished;
+
+    // Number of finished tweens between the start of the chunk holding `bucket_begin[k]` and
+    // `bucket_begin[k]`.
+    uint32_t finished_before_bucket[TWEEN_NUM_BUCKETS + 1];
+
+    // Handles of the tweens that finished this frame, also the completion queue read by
+    // `tm_tween_api->finished()`.
+    tm_tween_t *finished_handles;
+
+    // Due deadlines set aside by `wrap_repeats()`.
+    tween_deadline_t *due;
+
+    // `paused` words that a chunk only partially covers after compaction, merged serially.
+    uint64_t *edge_words;
+
+    // Work items for the evaluation phase: bucket and range of each item.
+    uint32_t *eval_items;
+} tween_update_job_t;
+
+// The dense arrays are partitioned into one contiguous bucket per built-in easing curve, plus one
+// for all custom curves, so batch evaluation runs one loop per curve instead of an indirect call
+// per tween. Buckets are kept sorted on
+// insertion and removal by rotating one tween per following bucket, see `insert_into_bucket()`.
+struct tm_tween_manager_o
+{
+    // Must be first, the parallel update swaps it with `scratch`.
+    TM_INHERITS(tween_arrays_t);
+
+    tm_entity_context_o *ctx;
+
+    // Next in `managers`.
+    struct tm_tween_manager_o *next;
+    tm_component_type_t tween_component;
+    tm_component_type_t transform_component;
+
+    // Child allocator of the entity context, owning the manager itself.
+    tm_allocator_i allocator;
+
+    // Forwards to `allocator` and counts into `allocation_stats`. Everything the manager owns is
+    // allocated through it.
+    tm_allocator_i counting_allocator;
+    tm_tween_allocation_stats_t allocation_stats;
+
+    // Counters of the frame in progress, published to `stats` at the end of each update.
+    tm_tween_stats_t frame_stats;
+    tween_lookup_counters_t lookup_counters[TWEEN_COUNTERS__COUNT];
+    tm_tween_stats_t stats;
+
+    uint32_t num_tweens;
+    uint32_t capacity;
+
+    // Bucket `k` holds the tweens with easing `k`, or with custom curves for `TWEEN_BUCKET_CUSTOM`,
+    // and spans `[bucket_begin[k], bucket_begin[k + 1])`. `bucket_begin[TWEEN_NUM_BUCKETS]` is
+    // always `num_tweens`.
+    uint32_t bucket_begin[TWEEN_NUM_BUCKETS + 1];
+
+    bool cache_values;
+
+    // A `tm_tween_easing_precision` value, for the single value reads.
+    uint32_t easing_precision;
+
+    // Slots past the end of `slots` may already be handed out by `reserve_handle()`, up to
+    // `num_reserved_slots`. Reserved slots hold generation 0 until their create command runs.
+    tween_slot_t *slots;
+    uint32_t first_free_slot;
+    atomic_uint32_t num_reserved_slots;
+
+    // Commands from `enqueue_create()`, `enqueue_destroy()` and `enqueue_pause()`, which may run
+    // on any thread. A bounded multi-producer queue where each cell's `sequence` tells producers
+    // whether it is free and the update whether it is written, so neither side takes a lock. Only
+    // the update reads it, so `command_head` is a plain counter.
+    tween_command_t *commands;
+    atomic_uint64_t command_tail;
+    uint64_t command_head;
+
+    // Free slots moved out of the free list by the update, handed out lock-free by
+    // `reserve_handle()`. Only the update writes entries and `reserve_tail`.
+    atomic_uint64_t *reserve_ring;
+    atomic_uint64_t reserve_head;
+    atomic_uint64_t reserve_tail;
+
+    tween_vector_t *vectors;
+    uint32_t first_free_vector;
+
+    // Timelines and their keyframes are shared by every tween playing them.
+    tween_timeline_t *timelines;
+    tm_tween_keyframe_t *keyframes;
+    tween_playhead_t *playheads;
+    uint32_t first_free_playhead;
+    uint32_t num_playheads;
+
+    tween_successor_t *successors;
+    uint32_t first_free_successor;
+
+    // Number of tweens with cycles left to repeat. `wrap_repeats()` does nothing while it is zero.
+    uint32_t num_repeating;
+
+    // Values published for readers on other threads. Readers pin the published buffer with one
+    // atomic add on `snapshot_state`, which holds the index of that buffer in its high word and
+    // the number of readers that entered it in the low word, so no reader ever waits or retries.
+    bool snapshot_enabled;
+    tween_snapshot_t snapshots[2];
+    atomic_uint64_t snapshot_state;
+
+    // Tween groups, `groups[0]` is the root group.
+    tween_group_t *groups;
+
+    // Updates of at least this many tweens are split into chunks and run through `scheduler`.
+    uint32_t parallel_threshold;
+    tm_tween_scheduler_i scheduler;
+
+    // Compaction target for the parallel update, allocated on first use with `capacity` entries.
+    tween_arrays_t scratch;
+    bool has_scratch;
+
+    tween_update_job_t job;
+
+    // Storage for the default, job system based, scheduler.
+    struct tm_jobdecl_t *job_decls;
+    struct tween_parallel_for_item_t *job_items;
+};
+
+#if defined(_MSC_VER)
+#define TWEEN_THREAD_LOCAL __declspec(thread)
+#else
+#define TWEEN_THREAD_LOCAL __thread
+#endif
+
+// Managers of every entity context with a tween system. Changed by context creation and
+// destruction only, which the engine does from one thread.
+static tm_tween_manager_o *managers;
+
+// Manager the API functions use on this thread, see `tm_tween_api->set_thread_manager()`.
+static TWEEN_THREAD_LOCAL tm_tween_manager_o *thread_manager;
+
+static inline tm_tween_manager_o *current_manager(void)
+{
+    return thread_manager ? thread_manager : tm_tween_api->manager;
+}
+
+static tm_tween_manager_o *find_manager(const tm_entity_context_o *ctx)
+{
+    tm_tween_manager_o *m = managers;
+    while (m && m->ctx != ctx)
+        m = m->next;
+    return m;
+}
+
+static inline bool paused_bit(const tm_tween_manager_o *manager, uint32_t i)
+{
+    return (manager->paused[i / 64] >> (i % 64)) & 1;
+}
+
+static inline void set_paused_bit(tm_tween_manager_o *manager, uint32_t i, bool paused)
+{
+    const uint64_t bit = 1ULL << (i % 64);
+    if (paused)
+        manager->paused[i / 64] |= bit;
+    else
+        manager->paused[i / 64] &= ~bit;
+}
+
+static inline double group_time(const tm_tween_manager_o *manager, uint32_t i)
+{
+    return manager->groups[manager->group[i]].time;
+}
+
+// Clamped at 0, as moving a tween between group clocks can round it slightly negative.
+static inline float elapsed_time(const tm_tween_manager_o *manager, uint32_t i)
+{
+    const double elapsed = (paused_bit(manager, i) ? 0.0 : group_time(manager, i)) - manager->start[i];
+    return elapsed > 0.0 ? (float)elapsed : 0.0f;
+}
+
+static inline float progress(const tm_tween_manager_o *manager, uint32_t i)
+{
+    return elapsed_time(manager, i) * manager->inv_duration[i];
+}
+
+// Written so that `e == 0` and `e == 1` give exactly `from` and `to`.
+static inline float tween_lerp(float from, float to, float e)
+{
+    return (1.0f - e) * from + e * to;
+}
+
+// Backward cycles run the curve from 1 to 0 and end on `from`.
+static float evaluate(const tm_tween_manager_o *manager, uint32_t i)
+{
+    const float t = progress(manager, i);
+    const uint32_t easing = manager->easing[i];
+    const float from = manager->from[i];
+    const float to = manager->to[i];
+    if (easing & TWEEN_EASING_REVERSED)
+        return t < 1.0f ? tween_lerp(from, to, ease_value(easing & ~TWEEN_EASING_REVERSED, manager->easing_precision, 1.0f - t)) : from;
+    return t < 1.0f ? tween_lerp(from, to, ease_value(easing, manager->easing_precision, t)) : to;
+}
+
+static inline float srgb_to_linear(float c)
+{
+    return c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+}
+
+static inline float linear_to_srgb(float c)
+{
+    if (c <= 0.0f)
+        return 0.0f;
+    return c <= 0.0031308f ? c * 12.92f : 1.055f * powf(c, 1.0f / 2.4f) - 0.055f;
+}
+
+static void normalize_quaternion(float *q)
+{
+    const float length_sq = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
+    if (!(length_sq > 0.0f))
+    {
+        q[0] = q[1] = q[2] = 0.0f;
+        q[3] = 1.0f;
+        return;
+    }
+
+    const float inv_length = 1.0f / sqrtf(length_sq);
+    for (uint32_t c = 0; c < 4; ++c)
+        q[c] *= inv_length;
+}
+
+// Interpolates a vector tween at eased progress `e`. Every type starts from a plain 4-wide lerp.
+static void interpolate_vector(const tween_vector_t *v, float e, float *res)
+{
+    for (uint32_t c = 0; c < 4; ++c)
+        res[c] = tween_lerp(v->from[c], v->to[c], e);
+
+    switch (v->type)
+    {
+    case TM_TWEEN_VALUE_TYPE_QUATERNION_NLERP:
+        normalize_quaternion(res);
+        break;
+
+    case TM_TWEEN_VALUE_TYPE_QUATERNION_SLERP: {
+        // Endpoints are normalized with `dot >= 0`. Close to each other, nlerp is exact enough and
+        // avoids dividing by a tiny `sin(theta)`.
+        const float dot = v->from[0] * v->to[0] + v->from[1] * v->to[1] + v->from[2] * v->to[2] + v->from[3] * v->to[3];
+        if (dot > 0.9995f)
+        {
+            normalize_quaternion(res);
+            break;
+        }
+
+        const float theta = acosf(dot);
+        const float inv_sin = 1.0f / sinf(theta);
+        const float a = sinf((1.0f - e) * theta) * inv_sin;
+        const float b = sinf(e * theta) * inv_sin;
+        for (uint32_t c = 0; c < 4; ++c)
+            res[c] = a * v->from[c] + b * v->to[c];
+        break;
+    }
+
+    case TM_TWEEN_VALUE_TYPE_COLOR:
+        for (uint32_t c = 0; c < 3; ++c)
+            res[c] = linear_to_srgb(res[c]);
+        break;
+    }
+}
+
+// Returns the keyframe starting the segment of `timeline` under time `t`, starting the search at
+// `cursor`. Playback moves forward, so this is usually a single comparison.
+static uint32_t find_segment(const tm_tween_manager_o *manager, const tween_timeline_t *timeline, uint32_t cursor, float t)
+{
+    const tm_tween_keyframe_t *keys = manager->keyframes + timeline->first_key;
+    uint32_t k = cursor;
+    while (k > 0 && t < keys[k].time)
+        --k;
+    while (k + 1 < timeline->num_keys && t >= keys[k + 1].time)
+        ++k;
+    return k;
+}
+
+static float sample_timeline(const tm_tween_manager_o *manager, const tween_playhead_t *playhead, float t)
+{
+    const tween_timeline_t *timeline = manager->timelines + playhead->timeline;
+    const tm_tween_keyframe_t *keys = manager->keyframes + timeline->first_key;
+    const uint32_t k = find_segment(manager, timeline, playhead->cursor, t);
+
+    if (k + 1 == timeline->num_keys || t <= keys[k].time)
+        return keys[k].value;
+
+    const float u = (t - keys[k].time) / (keys[k + 1].time - keys[k].time);
+    return tween_lerp(keys[k].value, keys[k + 1].value, ease_value(keys[k].easing, manager->easing_precision, u));
+}
+
+// Evaluates the tweens in `[begin, end)`, which must all be in `bucket`, into `values`.
+static void evaluate_bucket(const tm_tween_manager_o *manager, uint32_t bucket, uint32_t begin, uint32_t end, float *values)
+{
+    const easingBatchFunction ease = bucket != TWEEN_BUCKET_CUSTOM ? easingBatchFunctions[bucket] : 0;
+
+    // The batch kernels beat table lookups whenever they are vectorized.
+    const float *table = !TM_TWEEN_EASING_SIMD && ease && manager->easing_precision == TM_TWEEN_EASING_PRECISION_TABLE ? easingTables[bucket] : 0;
+
+    // Work in chunks so the progress scratch stays in L1.
+    float t[256];
+    for (uint32_t chunk = begin; chunk < end; chunk += TM_ARRAY_COUNT(t))
+    {
+        const uint32_t n = end - chunk < TM_ARRAY_COUNT(t) ? end - chunk : TM_ARRAY_COUNT(t);
+        const float *inv_duration = manager->inv_duration + chunk;
+        const float *from = manager->from + chunk;
+        const float *to = manager->to + chunk;
+        const uint16_t *easing = manager->easing + chunk;
+        float *res = values + chunk;
+
+        // Backward cycles mirror the progress, which the curves map to 1 and 0 exactly at its ends.
+        for (uint32_t j = 0; j < n; ++j)
+        {
+            const float p = elapsed_time(manager, chunk + j) * inv_duration[j];
+            const float c = p < 1.0f ? p : 1.0f;
+            t[j] = easing[j] & TWEEN_EASING_REVERSED ? 1.0f - c : c;
+        }
+
+        if (table)
+        {
+            for (uint32_t j = 0; j < n; ++j)
+                t[j] = easeTableLookup(table, t[j]);
+        }
+        else if (ease)
+            ease(t, t, n);
+        else
+        {
+            // Curves may end anywhere, finished tweens must still land on `to`, or `from` when
+            // they end backwards.
+            for (uint32_t j = 0; j < n; ++j)
+            {
+                const bool reversed = easing[j] & TWEEN_EASING_REVERSED;
+                const bool finished = reversed ? !(t[j] > 0.0f) : !(t[j] < 1.0f);
+                t[j] = finished ? (reversed ? 0.0f : 1.0f) : sample_curve(custom_curve(easing[j]), t[j]);
+            }
+        }
+
+        for (uint32_t j = 0; j < n; ++j)
+            res[j] = tween_lerp(from[j], to[j], t[j]);
+    }
+}
+
+static void evaluate_all_buckets(const tm_tween_manager_o *manager, float *values)
+{
+    for (uint32_t k = 0; k < TWEEN_NUM_BUCKETS; ++k)
+        evaluate_bucket(manager, k, manager->bucket_begin[k], manager->bucket_begin[k + 1], values);
+}
+
+static void *counting_realloc(tm_allocator_i *a, void *ptr, uint64_t old_size, uint64_t new_size, const char *file, uint32_t line)
+{
+    tm_tween_manager_o *manager = (tm_tween_manager_o *)a->inst;
+    tm_tween_allocation_stats_t *stats = &manager->allocation_stats;
+    if (new_size)
+        ++stats->num_allocations;
+    else if (ptr)
+        ++stats->num_frees;
+    stats->allocated_bytes += new_size - old_size;
+    if (stats->allocated_bytes > stats->peak_allocated_bytes)
+        stats->peak_allocated_bytes = stats->allocated_bytes;
+
+    return manager->allocator.realloc(&manager->allocator, ptr, old_size, new_size, file, line);
+}
+
+#define TWEEN_CARVE_ARRAY(arrays, arr, count) \
+    (arrays)->arr = block ? (void *)(block + size) : NULL, size += ((count) * sizeof(*(arrays)->arr) + 63) & ~63ULL
+
+// Points the arrays into `block`, each 64-byte aligned, and returns the size of the block needed
+// for `capacity` tweens. Only computes the size if `block` is NULL.
+static uint64_t carve_arrays(tween_arrays_t *arrays, uint8_t *block, uint32_t capacity)
+{
+    uint64_t size = 0;
+    TWEEN_CARVE_ARRAY(arrays, start, capacity);
+    TWEEN_CARVE_ARRAY(arrays, inv_duration, capacity);
+    TWEEN_CARVE_ARRAY(arrays, paused, (capacity + 63) / 64);
+    TWEEN_CARVE_ARRAY(arrays, group, capacity);
+    TWEEN_CARVE_ARRAY(arrays, from, capacity);
+    TWEEN_CARVE_ARRAY(arrays, to, capacity);
+    TWEEN_CARVE_ARRAY(arrays, easing, capacity);
+    TWEEN_CARVE_ARRAY(arrays, handle, capacity);
+    TWEEN_CARVE_ARRAY(arrays, values, capacity);
+    return size;
+}
+
+#define TWEEN_COPY_ARRAY(dst, src, arr, count) \
+    memcpy((dst)->arr, (src)->arr, (count) * sizeof(*(dst)->arr))
+
+// Moves `arrays` to a block for `new_capacity` tweens, keeping the first `num_to_keep`.
+static void realloc_arrays(tm_tween_manager_o *manager, tween_arrays_t *arrays, uint32_t old_capacity, uint32_t new_capacity, uint32_t num_to_keep)
+{
+    const tween_arrays_t old = *arrays;
+    const uint64_t old_size = old_capacity ? carve_arrays(&(tween_arrays_t){ 0 }, NULL, old_capacity) : 0;
+    const uint64_t new_size = new_capacity ? carve_arrays(arrays, NULL, new_capacity) : 0;
+
+    uint8_t *block = new_size ? tm_alloc(&manager->counting_allocator, new_size) : NULL;
+    carve_arrays(arrays, block, new_capacity);
+
+    if (block)
+    {
+        memset(arrays->paused, 0, ((new_capacity + 63) / 64) * sizeof(uint64_t));
+        num_to_keep = num_to_keep < new_capacity ? num_to_keep : new_capacity;
+        if (num_to_keep)
+        {
+            TWEEN_COPY_ARRAY(arrays, &old, start, num_to_keep);
+            TWEEN_COPY_ARRAY(arrays, &old, inv_duration, num_to_keep);
+            TWEEN_COPY_ARRAY(arrays, &old, paused, (num_to_keep + 63) / 64);
+            TWEEN_COPY_ARRAY(arrays, &old, group, num_to_keep);
+            TWEEN_COPY_ARRAY(arrays, &old, from, num_to_keep);
+            TWEEN_COPY_ARRAY(arrays, &old, to, num_to_keep);
+            TWEEN_COPY_ARRAY(arrays, &old, easing, num_to_keep);
+            TWEEN_COPY_ARRAY(arrays, &old, handle, num_to_keep);
+            TWEEN_COPY_ARRAY(arrays, &old, values, num_to_keep);
+        }
+    }
+
+    if (old_size)
+        tm_free(&manager->counting_allocator, old.start, old_size);
+}
+
+static void set_capacity(tm_tween_manager_o *manager, uint32_t new_capacity)
+{
+    realloc_arrays(manager, (tween_arrays_t *)manager, manager->capacity, new_capacity, manager->num_tweens);
+    if (manager->has_scratch)
+        realloc_arrays(manager, &manager->scratch, manager->capacity, new_capacity, 0);
+    manager->capacity = new_capacity;
+}
+
+// Returns true and the dense index of `tween` if it is alive. Generation 0 is never handed out but
+// is held by reserved slots and by the filler slots pushed when `slots` grows, so it is rejected
+// before it can match one of them.
+static bool lookup(const tm_tween_manager_o *manager, tm_tween_t tween, uint32_t *index)
+{
+    if (!manager || !tween.generation || tween.index >= tm_carray_size(manager->slots))
+        return false;
+
+    const tween_slot_t *slot = &manager->slots[tween.index];
+    if (slot->generation != tween.generation)
+        return false;
+
+    *index = slot->index;
+    return true;
+}
+
+// `lookup()` for the lookups reported in `tm_tween_stats_t`, counted into `lookup_counters[counters]`.
+static bool counted_lookup(tm_tween_manager_o *manager, uint32_t counters, tm_tween_t tween, uint32_t *index)
+{
+    if (!manager)
+        return false;
+
+    const bool found = lookup(manager, tween, index);
+    ++manager->lookup_counters[counters].lookups;
+    manager->lookup_counters[counters].misses += !found;
+    return found;
+}
+
+// Returns a handle for a tween created later by the update. Lock-free, callable from any thread.
+static tm_tween_t reserve_handle(tm_tween_manager_o *manager)
+{
+    uint64_t head = atomic_load_uint64_t(&manager->reserve_head);
+    while (head != atomic_load_uint64_t(&manager->reserve_tail))
+    {
+        // Read before claiming: if the update overwrote the entry, `reserve_head` moved and the
+        // claim fails.
+        const uint64_t handle = atomic_load_uint64_t(manager->reserve_ring + head % TWEEN_RESERVE_RING_SIZE);
+        if (atomic_compare_exchange_weak_uint64_t(&manager->reserve_head, &head, head + 1))
+            return (tm_tween_t){ .u64 = handle };
+    }
+
+    return (tm_tween_t){ .index = atomic_fetch_add_uint32_t(&manager->num_reserved_slots, 1), .generation = 1 };
+}
+
+// Moves free slots to the reserve ring, marking them reserved.
+static void refill_reserve_ring(tm_tween_manager_o *manager)
+{
+    uint64_t tail = atomic_load_uint64_t(&manager->reserve_tail);
+    while (manager->first_free_slot != TWEEN_NO_SLOT && tail - atomic_load_uint64_t(&manager->reserve_head) < TWEEN_RESERVE_RING_SIZE)
+    {
+        const uint32_t slot_index = manager->first_free_slot;
+        tween_slot_t *slot = &manager->slots[slot_index];
+        manager->first_free_slot = slot->index;
+
+        const tm_tween_t handle = { .index = slot_index, .generation = slot->generation };
+        slot->generation = 0;
+        atomic_store_uint64_t(manager->reserve_ring + tail % TWEEN_RESERVE_RING_SIZE, handle.u64);
+        ++tail;
+    }
+    atomic_store_uint64_t(&manager->reserve_tail, tail);
+}
+
+// Sets up the slot of `tween` for the tween at dense index `tween_index`. `tween` is a handle from
+// `reserve_handle()`, or zero to take a free slot.
+static tm_tween_t allocate_slot(tm_tween_manager_o *manager, tm_tween_t tween, uint32_t tween_index)
+{
+    if (!tween.u64 && manager->first_free_slot != TWEEN_NO_SLOT)
+    {
+        tween = (tm_tween_t){ .index = manager->first_free_slot, .generation = manager->slots[manager->first_free_slot].generation };
+        manager->first_free_slot = manager->slots[tween.index].index;
+    }
+    else if (!tween.u64)
+    {
+        tween = (tm_tween_t){ .index = atomic_fetch_add_uint32_t(&manager->num_reserved_slots, 1), .generation = 1 };
+    }
+
+    while (tm_carray_size(manager->slots) <= tween.index)
+        tm_carray_push(manager->slots, ((tween_slot_t){ .generation = 0 }), &manager->counting_allocator);
+
+    tween_slot_t *slot = &manager->slots[tween.index];
+    slot->generation = tween.generation;
+    slot->index = tween_index;
+    slot->heap_index = TWEEN_NO_SLOT;
+    slot->vector = TWEEN_NO_SLOT;
+    slot->playhead = TWEEN_NO_SLOT;
+    slot->first_successor = TWEEN_NO_SLOT;
+    slot->waiting = 0;
+    slot->paused = false;
+    slot->repeats = 0;
+    slot->repeat_mode = TM_TWEEN_REPEAT_RESTART;
+    return tween;
+}
+
+static void free_slot(tm_tween_manager_o *manager, uint32_t slot_index)
+{
+    tween_slot_t *slot = &manager->slots[slot_index];
+
+    if (slot->vector != TWEEN_NO_SLOT)
+    {
+        manager->vectors[slot->vector].next_free = manager->first_free_vector;
+        manager->first_free_vector = slot->vector;
+    }
+
+    if (slot->playhead != TWEEN_NO_SLOT)
+    {
+        manager->playheads[slot->playhead].slot = TWEEN_NO_SLOT;
+        manager->playheads[slot->playhead].next_free = manager->first_free_playhead;
+        manager->first_free_playhead = slot->playhead;
+        --manager->num_playheads;
+    }
+
+    if (slot->repeats)
+        --manager->num_repeating;
+
+    // Generation 0 is reserved for the zero handle.
+    if (++slot->generation == 0)
+        slot->generation = 1;
+
+    slot->index = manager->first_free_slot;
+    manager->first_free_slot = slot_index;
+}
+
+static inline void place_deadline(tm_tween_manager_o *manager, tween_group_t *group, uint32_t pos, tween_deadline_t d)
+{
+    group->deadlines[pos] = d;
+    manager->slots[d.slot].heap_index = pos;
+}
+
+static void sift_deadline(tm_tween_manager_o *manager, tween_group_t *group, uint32_t pos)
+{
+    const tween_deadline_t *heap = group->deadlines;
+    const tween_deadline_t d = heap[pos];
+    const uint32_t n = (uint32_t)tm_carray_size(heap);
+
+    while (pos > 0 && d.time < heap[(pos - 1) / 2].time)
+    {
+        place_deadline(manager, group, pos, heap[(pos - 1) / 2]);
+        pos = (pos - 1) / 2;
+    }
+
+    while (2 * pos + 1 < n)
+    {
+        uint32_t child = 2 * pos + 1;
+        if (child + 1 < n && heap[child + 1].time < heap[child].time)
+            ++child;
+        if (!(heap[child].time < d.time))
+            break;
+        place_deadline(manager, group, pos, heap[child]);
+        pos = child;
+    }
+
+    place_deadline(manager, group, pos, d);
+}
+
+static void push_deadline(tm_tween_manager_o *manager, uint32_t group_index, uint32_t slot, double time)
+{
+    tween_group_t *group = manager->groups + group_index;
+    const tween_deadline_t d = { .time = time, .slot = slot };
+    tm_carray_push(group->deadlines, d, &manager->counting_allocator);
+    sift_deadline(manager, group, (uint32_t)tm_carray_size(group->deadlines) - 1);
+}
+
+static void remove_deadline(tm_tween_manager_o *manager, uint32_t slot)
+{
+    const uint32_t pos = manager->slots[slot].heap_index;
+    if (pos == TWEEN_NO_SLOT)
+        return;
+
+    tween_group_t *group = manager->groups + manager->group[manager->slots[slot].index];
+    manager->slots[slot].heap_index = TWEEN_NO_SLOT;
+    const tween_deadline_t last = tm_carray_pop(group->deadlines);
+    if (pos < tm_carray_size(group->deadlines))
+    {
+        place_deadline(manager, group, pos, last);
+        sift_deadline(manager, group, pos);
+    }
+}
+
+// Time left until the tween at `i` finishes, negative by the overshoot once it has, so deadlines
+// pushed from it keep the time carried over to successors.
+static double remaining_time(const tm_tween_manager_o *manager, uint32_t i)
+{
+    const double elapsed = (paused_bit(manager, i) ? 0.0 : group_time(manager, i)) - manager->start[i];
+    return (double)manager->slots[manager->handle[i].index].duration - elapsed;
+}
+
+// Pausing takes the tween out of `deadlines`, resuming puts it back with the time it had left. A
+// tween paused after it finished stays in, so it is still removed on the next update.
+static void apply_paused(tm_tween_manager_o *manager, uint32_t i, bool paused)
+{
+    if (paused_bit(manager, i) == paused)
+        return;
+
+    const double time = group_time(manager, i);
+    manager->start[i] = paused ? manager->start[i] - time : manager->start[i] + time;
+    set_paused_bit(manager, i, paused);
+
+    const uint32_t slot = manager->handle[i].index;
+    const double remaining = remaining_time(manager, i);
+    if (paused && remaining > 0.0)
+        remove_deadline(manager, slot);
+    else if (!paused && manager->slots[slot].heap_index == TWEEN_NO_SLOT)
+        push_deadline(manager, manager->group[i], slot, time + remaining);
+}
+
+// Pauses or resumes the tween at `i` on request of the user. Tweens waiting for others stay paused
+// until those finish, and then only start if the user hasn't paused them.
+static void set_paused(tm_tween_manager_o *manager, uint32_t i, bool paused)
+{
+    tween_slot_t *s = manager->slots + manager->handle[i].index;
+    s->paused = paused;
+    apply_paused(manager, i, paused || s->waiting);
+}
+
+// Makes the tween at `i` wait for the tween in `slot`.
+static void add_successor(tm_tween_manager_o *manager, uint32_t slot, uint32_t i)
+{
+    ++manager->slots[manager->handle[i].index].waiting;
+    apply_paused(manager, i, true);
+
+    const tween_successor_t link = { .tween = manager->handle[i], .next = manager->slots[slot].first_successor };
+    uint32_t index = manager->first_free_successor;
+    if (index != TWEEN_NO_SLOT)
+    {
+        manager->first_free_successor = manager->successors[index].next;
+        manager->successors[index] = link;
+    }
+    else
+    {
+        index = (uint32_t)tm_carray_size(manager->successors);
+        tm_carray_push(manager->successors, link, &manager->counting_allocator);
+    }
+    manager->slots[slot].first_successor = index;
+}
+
+// Releases the tweens waiting for the tween in `slot`. Those waiting for nothing else get
+// `leftover` seconds of progress, the time by which `slot` overshot its end, and start unless
+// paused by the user.
+static void start_successors(tm_tween_manager_o *manager, uint32_t slot, double leftover)
+{
+    uint32_t index = manager->slots[slot].first_successor;
+    manager->slots[slot].first_successor = TWEEN_NO_SLOT;
+
+    while (index != TWEEN_NO_SLOT)
+    {
+        tween_successor_t *link = manager->successors + index;
+        uint32_t i;
+        if (lookup(manager, link->tween, &i) && !--manager->slots[link->tween.index].waiting)
+        {
+            // Paused tweens hold their negated elapsed time in `start`.
+            manager->start[i] -= leftover;
+            apply_paused(manager, i, manager->slots[link->tween.index].paused);
+        }
+
+        const uint32_t next = link->next;
+        link->next = manager->first_free_successor;
+        manager->first_free_successor = index;
+        index = next;
+    }
+}
+
+// Moves the tween at `i` to another group, keeping its elapsed time.
+static void set_group_at(tm_tween_manager_o *manager, uint32_t i, uint32_t group)
+{
+    if (manager->group[i] == group)
+        return;
+
+    const uint32_t slot = manager->handle[i].index;
+    const bool had_deadline = manager->slots[slot].heap_index != TWEEN_NO_SLOT;
+    const double remaining = remaining_time(manager, i);
+    remove_deadline(manager, slot);
+
+    const double time = manager->groups[group].time;
+    if (!paused_bit(manager, i))
+        manager->start[i] += time - group_time(manager, i);
+    manager->group[i] = (uint16_t)group;
+
+    if (had_deadline)
+        push_deadline(manager, group, slot, time + remaining);
+}
+
+static uint32_t find_group(const tm_tween_manager_o *manager, tm_strhash_t name)
+{
+    if (!manager)
+        return TWEEN_NO_SLOT;
+
+    const uint32_t n = (uint32_t)tm_carray_size(manager->groups);
+    for (uint32_t g = 0; g < n; ++g)
+    {
+        if (TM_STRHASH_EQUAL(manager->groups[g].name, name))
+            return g;
+    }
+    return TWEEN_NO_SLOT;
+}
+
+static uint32_t add_group(tm_tween_manager_o *manager, tm_strhash_t name, uint32_t parent)
+{
+    const tween_group_t group = {
+        .name = name,
+        .parent = parent,
+        .time_scale = 1.0f,
+        .effective_scale = 1.0f,
+    };
+    tm_carray_push(manager->groups, group, &manager->counting_allocator);
+    return (uint32_t)tm_carray_size(manager->groups) - 1;
+}
+
+// Advances every group clock by `dt` scaled by the group and its ancestors. Parents come before
+// their children in `groups`, so their effective scale is already known.
+static void advance_groups(tm_tween_manager_o *manager, double dt)
+{
+    const uint32_t n = (uint32_t)tm_carray_size(manager->groups);
+    for (uint32_t g = 0; g < n; ++g)
+    {
+        tween_group_t *group = manager->groups + g;
+        const float parent_scale = g ? manager->groups[group->parent].effective_scale : 1.0f;
+        group->effective_scale = group->paused ? 0.0f : group->time_scale * parent_scale;
+        group->time += dt * group->effective_scale;
+    }
+}
+
+// Moves the tween at `src` to `dst`, overwriting whatever is there, and patches its slot.
+static void move_tween(tm_tween_manager_o *manager, uint32_t dst, uint32_t src)
+{
+    manager->start[dst] = manager->start[src];
+    manager->group[dst] = manager->group[src];
+    manager->inv_duration[dst] = manager->inv_duration[src];
+    set_paused_bit(manager, dst, paused_bit(manager, src));
+    manager->from[dst] = manager->from[src];
+    manager->to[dst] = manager->to[src];
+    manager->easing[dst] = manager->easing[src];
+    manager->handle[dst] = manager->handle[src];
+    manager->values[dst] = manager->values[src];
+    manager->slots[manager->handle[dst].index].index = dst;
+}
+
+// Makes room for a tween at the end of `bucket` and returns its index. Every non-empty bucket
+// after it moves its first tween to its end, so this costs at most one move per bucket.
+static uint32_t insert_into_bucket(tm_tween_manager_o *manager, uint32_t bucket)
+{
+    uint32_t hole = manager->num_tweens;
+    for (uint32_t k = TWEEN_NUM_BUCKETS - 1; k > bucket; --k)
+    {
+        const uint32_t first = manager->bucket_begin[k];
+        if (first != hole)
+            move_tween(manager, hole, first);
+        hole = first;
+        ++manager->bucket_begin[k];
+    }
+
+    manager->bucket_begin[TWEEN_NUM_BUCKETS] = ++manager->num_tweens;
+    return hole;
+}
+
+// Makes room for `counts[k]` tweens at the end of every bucket `k` and writes the index of the
+// first of them to `gap[k]`. Each bucket shifts by the number of tweens inserted before it, moving
+// at most that many of its tweens from its front to its end, like `insert_into_bucket()`.
+static void insert_into_buckets(tm_tween_manager_o *manager, const uint32_t *counts, uint32_t *gap)
+{
+    uint32_t shift = 0;
+    for (uint32_t k = 0; k < TWEEN_NUM_BUCKETS; ++k)
+        shift += counts[k];
+
+    uint32_t end = manager->num_tweens;
+    manager->num_tweens += shift;
+    manager->bucket_begin[TWEEN_NUM_BUCKETS] = manager->num_tweens;
+
+    for (uint32_t k = TWEEN_NUM_BUCKETS; k-- > 0;)
+    {
+        shift -= counts[k];
+        const uint32_t begin = manager->bucket_begin[k];
+        const uint32_t size = end - begin;
+        const uint32_t num_moved = shift < size ? shift : size;
+        const uint32_t dst = end > begin + shift ? end : begin + shift;
+        for (uint32_t j = 0; j < num_moved; ++j)
+            move_tween(manager, dst + j, begin + j);
+
+        manager->bucket_begin[k] = begin + shift;
+        gap[k] = begin + shift + size;
+        end = begin;
+    }
+}
+
+// Frees the slot of the tween at `i` and removes it from its bucket. The last tween of the bucket
+// fills the hole, then every following bucket moves its last tween to its front.
+static void remove_tween_at(tm_tween_manager_o *manager, uint32_t i)
+{
+    const uint32_t bucket = bucket_of(manager->easing[i]);
+
+    remove_deadline(manager, manager->handle[i].index);
+    free_slot(manager, manager->handle[i].index);
+
+    uint32_t hole = i;
+    for (uint32_t k = bucket; k < TWEEN_NUM_BUCKETS; ++k)
+    {
+        if (k != bucket)
+            --manager->bucket_begin[k];
+
+        const uint32_t last = manager->bucket_begin[k + 1] - 1;
+        if (last != hole)
+            move_tween(manager, hole, last);
+        hole = last;
+    }
+
+    set_paused_bit(manager, hole, false);
+    manager->bucket_begin[TWEEN_NUM_BUCKETS] = --manager->num_tweens;
+}
+
+// Sets up a float tween in group `group` at dense index `i`, a place made for it in the bucket of
+// the valid easing `easing`. It takes the slot of `tween`, a handle from `reserve_handle()`, or a
+// free slot if `tween` is zero.
+static tm_tween_t init_tween(tm_tween_manager_o *manager, uint32_t i, tm_tween_t tween, float from, float to, float duration, uint32_t easing, uint32_t group)
+{
+    tween = allocate_slot(manager, tween, i);
+
+    manager->start[i] = manager->groups[group].time;
+    manager->group[i] = (uint16_t)group;
+    manager->inv_duration[i] = duration > 0.0f ? 1.0f / duration : INFINITY;
+    manager->slots[tween.index].duration = duration > 0.0f ? duration : 0.0f;
+    set_paused_bit(manager, i, false);
+    push_deadline(manager, group, tween.index, manager->start[i] + (duration > 0.0f ? duration : 0.0));
+    manager->from[i] = from;
+    manager->to[i] = to;
+    manager->easing[i] = (uint16_t)easing;
+    manager->handle[i] = tween;
+    if (manager->cache_values)
+        manager->values[i] = evaluate(manager, i);
+
+    ++manager->frame_stats.num_created;
+    return tween;
+}
+
+// Creates a float tween in the slot of `tween`, a handle from `reserve_handle()`, or in a free
+// slot if `tween` is zero.
+static tm_tween_t create_tween(tm_tween_manager_o *manager, tm_tween_t tween, float from, float to, float duration, uint32_t easing)
+{
+    if (manager->num_tweens == manager->capacity)
+        set_capacity(manager, manager->capacity ? manager->capacity * 2 : 64);
+
+    easing = valid_easing(easing);
+    const uint32_t i = insert_into_bucket(manager, bucket_of(easing));
+    return init_tween(manager, i, tween, from, to, duration, easing, 0);
+}
+
+// Creates `n` float tweens in group `group`, growing the storage and rearranging the buckets once
+// for all of them.
+static void create_tweens(tm_tween_manager_o *manager, const float *from, const float *to, const float *duration, const uint32_t *easing, uint32_t n, uint32_t group, tm_tween_t *tweens)
+{
+    const uint32_t num_tweens = manager->num_tweens + n;
+    if (num_tweens > manager->capacity)
+    {
+        uint32_t capacity = manager->capacity ? manager->capacity * 2 : 64;
+        while (capacity < num_tweens)
+            capacity *= 2;
+        set_capacity(manager, capacity);
+    }
+    tm_carray_ensure(manager->slots, atomic_load_uint32_t(&manager->num_reserved_slots) + n, &manager->counting_allocator);
+    tm_carray_ensure(manager->groups[group].deadlines, tm_carray_size(manager->groups[group].deadlines) + n, &manager->counting_allocator);
+
+    uint32_t next[TWEEN_NUM_BUCKETS] = { 0 };
+    for (uint32_t k = 0; k < n; ++k)
+        ++next[bucket_of(valid_easing(easing[k]))];
+    insert_into_buckets(manager, next, next);
+
+    for (uint32_t k = 0; k < n; ++k)
+    {
+        const uint32_t e = valid_easing(easing[k]);
+        const uint32_t i = next[bucket_of(e)]++;
+        tweens[k] = init_tween(manager, i, (tm_tween_t){ 0 }, from[k], to[k], duration[k], e, group);
+    }
+}
+
+// Destroys `tween`, at dense index `i`, releasing the tweens waiting for it.
+static void destroy_tween(tm_tween_manager_o *manager, tm_tween_t tween, uint32_t i)
+{
+    ++manager->frame_stats.num_destroyed;
+    start_successors(manager, tween.index, 0.0);
+    remove_tween_at(manager, i);
+}
+
+// Like `destroy_tween()`, but leaves the tween in the dense arrays with a zero handle for
+// `remove_cleared()` to remove along with the others.
+static void clear_tween(tm_tween_manager_o *manager, tm_tween_t tween, uint32_t i)
+{
+    ++manager->frame_stats.num_destroyed;
+    start_successors(manager, tween.index, 0.0);
+    remove_deadline(manager, tween.index);
+    free_slot(manager, tween.index);
+    manager->handle[i].u64 = 0;
+}
+
+// Removes the tweens `clear_tween()` cleared, the first of them at `first`, in one pass that keeps
+// the order of the others, so buckets stay contiguous.
+static void remove_cleared(tm_tween_manager_o *manager, uint32_t first)
+{
+    uint32_t d = first;
+    for (uint32_t k = 0; k < TWEEN_NUM_BUCKETS; ++k)
+    {
+        const uint32_t end = manager->bucket_begin[k + 1];
+        if (end <= first)
+            continue;
+
+        uint32_t i = manager->bucket_begin[k];
+        if (i > first)
+            manager->bucket_begin[k] = d;
+        else
+            i = first;
+
+        for (; i < end; ++i)
+        {
+            if (!manager->handle[i].u64)
+                continue;
+            if (d != i)
+                move_tween(manager, d, i);
+            ++d;
+        }
+    }
+
+    for (uint32_t i = d; i < manager->num_tweens; ++i)
+        set_paused_bit(manager, i, false);
+    manager->num_tweens = d;
+    manager->bucket_begin[TWEEN_NUM_BUCKETS] = d;
+}
+
+// Claims the next cell of the command queue, or returns NULL if the queue is full. Lock-free,
+// callable from any thread. The command is run by the update once `publish_command()` is called.
+static tween_command_t *claim_command(tm_tween_manager_o *manager, uint64_t *position)
+{
+    if (!manager)
+        return 0;
+
+    uint64_t pos = atomic_load_uint64_t(&manager->command_tail);
+    for (;;)
+    {
+        tween_command_t *c = manager->commands + pos % TWEEN_COMMAND_QUEUE_SIZE;
+        const uint64_t sequence = atomic_load_uint64_t(&c->sequence);
+        if (sequence == pos)
+        {
+            if (atomic_compare_exchange_weak_uint64_t(&manager->command_tail, &pos, pos + 1))
+            {
+                *position = pos;
+                return c;
+            }
+        }
+        else if (sequence < pos)
+            return NULL;
+        else
+            pos = atomic_load_uint64_t(&manager->command_tail);
+    }
+}
+
+static void publish_command(tween_command_t *c, uint64_t position)
+{
+    atomic_store_uint64_t(&c->sequence, position + 1);
+}
+
+// Runs the commands queued before the call in queue order, stopping at the first one still being
+// written, which runs next update. Then refills the reserve ring.
+static void run_commands(tm_tween_manager_o *manager)
+{
+    const uint64_t end = atomic_load_uint64_t(&manager->command_tail);
+    while (manager->command_head != end)
+    {
+        tween_command_t *c = manager->commands + manager->command_head % TWEEN_COMMAND_QUEUE_SIZE;
+        if (atomic_load_uint64_t(&c->sequence) != manager->command_head + 1)
+            break;
+
+        uint32_t i;
+        if (c->type == TWEEN_COMMAND__CREATE)
+            create_tween(manager, c->tween, c->from, c->to, c->duration, c->easing);
+        else if (c->type == TWEEN_COMMAND__DESTROY && lookup(manager, c->tween, &i))
+            destroy_tween(manager, c->tween, i);
+        else if (c->type == TWEEN_COMMAND__PAUSE && lookup(manager, c->tween, &i))
+            set_paused(manager, i, c->paused);
+
+        atomic_store_uint64_t(&c->sequence, manager->command_head + TWEEN_COMMAND_QUEUE_SIZE);
+        ++manager->command_head;
+    }
+
+    refill_reserve_ring(manager);
+}
+
+static void tween_init(struct tm_entity_context_o *ctx, tm_entity_system_o *inst, struct tm_entity_commands_o *commands)
+{
+
+}
+
+// Starts the next cycle of the repeating tween in `slot`, whose deadline is due. All the cycles
+// the overshoot spans are skipped at once, the elapsed time keeps what is left of it.
+static void wrap_tween(tm_tween_manager_o *manager, uint32_t slot)
+{
+    tween_slot_t *s = manager->slots + slot;
+    const uint32_t i = s->index;
+    const double duration = s->duration;
+    const double overshoot = fmax(-remaining_time(manager, i), 0.0);
+
+    double cycles = floor(overshoot / duration) + 1.0;
+    double elapsed = fmod(overshoot, duration);
+    if (s->repeats != TM_TWEEN_REPEAT_FOREVER && cycles >= s->repeats)
+    {
+        cycles = s->repeats;
+        elapsed = overshoot + duration - cycles * duration;
+    }
+    if (s->repeats != TM_TWEEN_REPEAT_FOREVER)
+    {
+        s->repeats -= (uint32_t)cycles;
+        if (!s->repeats)
+            --manager->num_repeating;
+    }
+
+    const bool paused = paused_bit(manager, i);
+    const double time = group_time(manager, i);
+    manager->start[i] = (paused ? 0.0 : time) - elapsed;
+    if (s->repeat_mode == TM_TWEEN_REPEAT_YOYO && fmod(cycles, 2.0) != 0.0)
+        manager->easing[i] ^= TWEEN_EASING_REVERSED;
+
+    // A tween paused after its cycle ended only keeps its deadline if it is finished for good.
+    const double remaining = duration - elapsed;
+    if (paused && remaining > 0.0)
+    {
+        remove_deadline(manager, slot);
+        return;
+    }
+
+    // A cycle shorter than the resolution of the group clock would be due again right away and
+    // wrap forever, so the deadline of a tween that keeps repeating lands strictly after `time`.
+    // Such a tween wraps at most once per update.
+    double deadline = time + remaining;
+    if (s->repeats && !(deadline > time))
+        deadline = nextafter(time, INFINITY);
+
+    tween_group_t *group = manager->groups + manager->group[i];
+    group->deadlines[s->heap_index].time = deadline;
+    sift_deadline(manager, group, s->heap_index);
+}
+
+// Wraps the repeating tweens whose cycle ended by their group's time, so that the values of the
+// update already show their next cycle. Due deadlines of other tweens are set aside and put back
+// for `pop_finished()`.
+static void wrap_repeats(tm_tween_manager_o *manager)
+{
+    if (!manager->num_repeating)
+        return;
+
+    tween_update_job_t *job = &manager->job;
+    const uint32_t num_groups = (uint32_t)tm_carray_size(manager->groups);
+    for (uint32_t g = 0; g < num_groups; ++g)
+    {
+        tween_group_t *group = manager->groups + g;
+        tm_carray_shrink(job->due, 0);
+        while (tm_carray_size(group->deadlines) && group->deadlines[0].time <= group->time)
+        {
+            const tween_deadline_t d = group->deadlines[0];
+            if (manager->slots[d.slot].repeats)
+                wrap_tween(manager, d.slot);
+            else
+            {
+                remove_deadline(manager, d.slot);
+                tm_carray_push(job->due, d, &manager->counting_allocator);
+            }
+        }
+        for (const tween_deadline_t *d = job->due; d != tm_carray_end(job->due); ++d)
+            push_deadline(manager, g, d->slot, d->time);
+    }
+}
+
+// Pops every tween that finishes by its group's time off `deadlines` into `finished_handles`.
+// Repeating tweens are wrapped instead. Returns the number of finished tweens.
+static uint32_t pop_finished(tm_tween_manager_o *manager)
+{
+    tween_update_job_t *job = &manager->job;
+    tm_carray_shrink(job->finished_handles, 0);
+
+    const uint32_t num_groups = (uint32_t)tm_carray_size(manager->groups);
+    for (uint32_t g = 0; g < num_groups; ++g)
+    {
+        const tween_group_t *group = manager->groups + g;
+        while (tm_carray_size(group->deadlines) && group->deadlines[0].time <= group->time)
+        {
+            const uint32_t slot = group->deadlines[0].slot;
+            if (manager->slots[slot].repeats)
+            {
+                wrap_tween(manager, slot);
+                continue;
+            }
+
+            const tm_tween_t tween = { .index = slot, .generation = manager->slots[slot].generation };
+            const double leftover = group->time - group->deadlines[0].time;
+            remove_deadline(manager, slot);
+            tm_carray_push(job->finished_handles, tween, &manager->counting_allocator);
+            start_successors(manager, slot, leftover);
+        }
+    }
+
+    return (uint32_t)tm_carray_size(job->finished_handles);
+}
+
+// Moves the cursor of every timeline tween to the segment under its playhead.
+static void advance_timelines(tm_tween_manager_o *manager)
+{
+    if (!manager->num_playheads)
+        return;
+
+    for (tween_playhead_t *p = manager->playheads; p != tm_carray_end(manager->playheads); ++p)
+    {
+        if (p->slot == TWEEN_NO_SLOT)
+            continue;
+
+        const float t = evaluate(manager, manager->slots[p->slot].index);
+        p->cursor = find_segment(manager, manager->timelines + p->timeline, p->cursor, t);
+    }
+}
+
+static void remove_finished(tm_tween_manager_o *manager, uint32_t num_finished)
+{
+    uint32_t i;
+    for (uint32_t f = 0; f < num_finished; ++f)
+    {
+        if (lookup(manager, manager->job.finished_handles[f], &i))
+            remove_tween_at(manager, i);
+    }
+}
+
+static void update_serial(tm_tween_manager_o *manager, double dt)
+{
+    TM_PROFILER_BEGIN_LOCAL_SCOPE(tween_finish);
+    remove_finished(manager, pop_finished(manager));
+    TM_PROFILER_END_LOCAL_SCOPE(tween_finish);
+
+    TM_PROFILER_BEGIN_LOCAL_SCOPE(tween_advance);
+    advance_groups(manager, dt);
+    wrap_repeats(manager);
+    advance_timelines(manager);
+    TM_PROFILER_END_LOCAL_SCOPE(tween_advance);
+
+    if (manager->cache_values)
+    {
+        TM_PROFILER_BEGIN_LOCAL_SCOPE(tween_evaluate);
+        evaluate_all_buckets(manager, manager->values);
+        TM_PROFILER_END_LOCAL_SCOPE(tween_evaluate);
+    }
+}
+
+static inline bool expired_bit(const tween_update_job_t *job, uint32_t i)
+{
+    return (job->expired[i / 64] >> (i % 64)) & 1;
+}
+
+static inline uint32_t chunk_end(const tm_tween_manager_o *manager, uint32_t chunk)
+{
+    const uint32_t end = (chunk + 1) * TWEEN_CHUNK_SIZE;
+    return end < manager->num_tweens ? end : manager->num_tweens;
+}
+
+// Counts the finished tweens of a chunk and, for each bucket starting in the chunk, the finished
+// tweens before that bucket. Read-only, so chunks can run in any order.
+static void count_finished_task(void *data, uint32_t chunk)
+{
+    tween_update_job_t *job = data;
+    const tm_tween_manager_o *manager = job->manager;
+    const uint32_t begin = chunk * TWEEN_CHUNK_SIZE;
+    const uint32_t end = chunk_end(manager, chunk);
+
+    uint32_t finished = 0;
+    uint32_t i = begin;
+    for (uint32_t k = 0; k < TWEEN_NUM_BUCKETS; ++k)
+    {
+        const uint32_t bucket_begin = manager->bucket_begin[k];
+        if (bucket_begin < begin || bucket_begin >= end)
+            continue;
+
+        for (; i < bucket_begin; ++i)
+            finished += expired_bit(job, i);
+        job->finished_before_bucket[k] = finished;
+    }
+
+    for (; i < end; ++i)
+        finished += expired_bit(job, i);
+
+    job->finished[chunk] = finished;
+}
+
+// Copies the surviving tweens of a chunk into `scratch`. Survivors keep their order, so buckets
+// stay contiguous. Each chunk writes a disjoint range of the destination; `paused` words it only
+// partially covers go to `edge_words` instead.
+static void compact_task(void *data, uint32_t chunk)
+{
+    tween_update_job_t *job = data;
+    tm_tween_manager_o *manager = job->manager;
+    tween_arrays_t *dst = &manager->scratch;
+    const uint32_t begin = chunk * TWEEN_CHUNK_SIZE;
+    const uint32_t end = chunk_end(manager, chunk);
+
+    const uint32_t dst_begin = begin - job->finished[chunk];
+    const uint32_t dst_end = end - job->finished[chunk + 1];
+    uint32_t d = dst_begin;
+
+    uint64_t word = 0;
+    for (uint32_t i = begin; i < end; ++i)
+    {
+        if (expired_bit(job, i))
+            continue;
+
+        const bool paused = paused_bit(manager, i);
+        dst->start[d] = manager->start[i];
+        dst->group[d] = manager->group[i];
+        dst->inv_duration[d] = manager->inv_duration[i];
+        dst->from[d] = manager->from[i];
+        dst->to[d] = manager->to[i];
+        dst->easing[d] = manager->easing[i];
+        dst->handle[d] = manager->handle[i];
+        manager->slots[manager->handle[i].index].index = d;
+
+        word |= (uint64_t)paused << (d % 64);
+        ++d;
+        if (d % 64 == 0 || d == dst_end)
+        {
+            const uint32_t w = (d - 1) / 64;
+            const bool whole = w * 64 >= dst_begin && (w + 1) * 64 <= dst_end;
+            if (whole)
+                dst->paused[w] = word;
+            else
+                job->edge_words[2 * chunk + (w * 64 < dst_begin ? 0 : 1)] = word;
+            word = 0;
+        }
+    }
+}
+
+static void evaluate_task(void *data, uint32_t item)
+{
+    tween_update_job_t *job = data;
+    const uint32_t *it = job->eval_items + 3 * item;
+    evaluate_bucket(job->manager, it[0], it[1], it[2], job->manager->values);
+}
+
+static void ensure_job_capacity(tm_tween_manager_o *manager)
+{
+    tween_update_job_t *job = &manager->job;
+    const uint32_t num_chunks = (manager->num_tweens + TWEEN_CHUNK_SIZE - 1) / TWEEN_CHUNK_SIZE;
+    job->num_chunks = num_chunks;
+
+    tm_carray_resize(job->finished, num_chunks + 1, &manager->counting_allocator);
+    tm_carray_resize(job->edge_words, 2 * num_chunks, &manager->counting_allocator);
+}
+
+// Parallel version of `update_serial()`:
+//
+// 1. The finished tweens are popped off `deadlines`.
+// 2. If only a few finished, they are removed serially. Otherwise they are flagged in `expired`,
+//    each chunk counts its flagged tweens and a prefix sum over the counts gives each chunk its
+//    destination range. The chunks copy their survivors into `scratch`, which is then swapped in.
+// 3. If the value cache is enabled, buckets are evaluated in chunk-sized pieces.
+static void update_parallel(tm_tween_manager_o *manager, double dt)
+{
+    const tm_tween_scheduler_i *scheduler = &manager->scheduler;
+    tween_update_job_t *job = &manager->job;
+
+    TM_PROFILER_BEGIN_LOCAL_SCOPE(tween_finish);
+    const uint32_t total_finished = pop_finished(manager);
+
+    if (!total_finished || total_finished < manager->num_tweens / TWEEN_COMPACTION_DIVISOR)
+    {
+        remove_finished(manager, total_finished);
+    }
+    else
+    {
+        ensure_job_capacity(manager);
+
+        const uint32_t num_words = (manager->num_tweens + 63) / 64;
+        tm_carray_resize(job->expired, num_words, &manager->counting_allocator);
+        memset(job->expired, 0, num_words * sizeof(uint64_t));
+        for (uint32_t f = 0; f < total_finished; ++f)
+        {
+            const uint32_t i = manager->slots[job->finished_handles[f].index].index;
+            job->expired[i / 64] |= 1ULL << (i % 64);
+        }
+
+        scheduler->parallel_for(scheduler->inst, count_finished_task, job, job->num_chunks);
+
+        uint32_t prefix = 0;
+        for (uint32_t c = 0; c < job->num_chunks; ++c)
+        {
+            const uint32_t n = job->finished[c];
+            job->finished[c] = prefix;
+            prefix += n;
+        }
+        job->finished[job->num_chunks] = prefix;
+
+        if (!manager->has_scratch)
+        {
+            realloc_arrays(manager, &manager->scratch, 0, manager->capacity, 0);
+            manager->has_scratch = true;
+        }
+
+        const uint32_t num_survivors = manager->num_tweens - total_finished;
+        memset(manager->scratch.paused, 0, ((manager->capacity + 63) / 64) * sizeof(uint64_t));
+        memset(job->edge_words, 0, 2 * job->num_chunks * sizeof(uint64_t));
+
+        scheduler->parallel_for(scheduler->inst, compact_task, job, job->num_chunks);
+
+        for (uint32_t c = 0; c < job->num_chunks; ++c)
+        {
+            const uint32_t dst_begin = c * TWEEN_CHUNK_SIZE - job->finished[c];
+            const uint32_t dst_end = chunk_end(manager, c) - job->finished[c + 1];
+            if (dst_begin == dst_end)
+                continue;
+            manager->scratch.paused[dst_begin / 64] |= job->edge_words[2 * c];
+            manager->scratch.paused[(dst_end - 1) / 64] |= job->edge_words[2 * c + 1];
+        }
+
+        for (uint32_t k = 0; k < TWEEN_NUM_BUCKETS; ++k)
+        {
+            const uint32_t b = manager->bucket_begin[k];
+            if (b < manager->num_tweens)
+                manager->bucket_begin[k] = b - job->finished[b / TWEEN_CHUNK_SIZE] - job->finished_before_bucket[k];
+            else
+                manager->bucket_begin[k] = num_survivors;
+        }
+
+        const tween_arrays_t arrays = *(tween_arrays_t *)manager;
+        *(tween_arrays_t *)manager = manager->scratch;
+        manager->scratch = arrays;
+        manager->num_tweens = num_survivors;
+        manager->bucket_begin[TWEEN_NUM_BUCKETS] = num_survivors;
+
+        for (uint32_t i = 0; i < total_finished; ++i)
+            free_slot(manager, job->finished_handles[i].index);
+    }
+    TM_PROFILER_END_LOCAL_SCOPE(tween_finish);
+
+    TM_PROFILER_BEGIN_LOCAL_SCOPE(tween_advance);
+    advance_groups(manager, dt);
+    wrap_repeats(manager);
+    advance_timelines(manager);
+    TM_PROFILER_END_LOCAL_SCOPE(tween_advance);
+
+    if (manager->cache_values)
+    {
+        TM_PROFILER_BEGIN_LOCAL_SCOPE(tween_evaluate);
+        tm_carray_shrink(job->eval_items, 0);
+        for (uint32_t k = 0; k < TWEEN_NUM_BUCKETS; ++k)
+        {
+            for (uint32_t b = manager->bucket_begin[k]; b < manager->bucket_begin[k + 1]; b += TWEEN_CHUNK_SIZE)
+            {
+                const uint32_t e = b + TWEEN_CHUNK_SIZE < manager->bucket_begin[k + 1] ? b + TWEEN_CHUNK_SIZE : manager->bucket_begin[k + 1];
+                tm_carray_push(job->eval_items, k, &manager->counting_allocator);
+                tm_carray_push(job->eval_items, b, &manager->counting_allocator);
+                tm_carray_push(job->eval_items, e, &manager->counting_allocator);
+            }
+        }
+        scheduler->parallel_for(scheduler->inst, evaluate_task, job, (uint32_t)tm_carray_size(job->eval_items) / 3);
+        TM_PROFILER_END_LOCAL_SCOPE(tween_evaluate);
+    }
+}
+
+typedef struct tween_parallel_for_item_t
+{
+    void (*task)(void *data, uint32_t i);
+    void *data;
+    uint32_t i;
+    TM_PAD(4);
+} tween_parallel_for_item_t;
+
+static void job_system_item_f(void *data)
+{
+    const tween_parallel_for_item_t *item = data;
+    item->task(item->data, item->i);
+}
+
+// Default scheduler: one job per item, waited on from the calling thread.
+static void job_system_parallel_for(void *inst, void (*task)(void *data, uint32_t i), void *data, uint32_t n)
+{
+    tm_tween_manager_o *manager = inst;
+    if (!n)
+        return;
+
+    tm_carray_resize(manager->job_decls, n, &manager->counting_allocator);
+    tm_carray_resize(manager->job_items, n, &manager->counting_allocator);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        manager->job_items[i] = (tween_parallel_for_item_t){ .task = task, .data = data, .i = i };
+        manager->job_decls[i] = (tm_jobdecl_t){ .task = job_system_item_f, .data = manager->job_items + i };
+    }
+
+    tm_atomic_counter_o *counter = tm_job_system_api->run_jobs(manager->job_decls, n);
+    tm_job_system_api->wait_for_counter_and_free(counter);
+}
+
+// Returns the value of the tween at slot `slot` and dense index `i`, as read by `get_float()`.
+static float tween_value(const tm_tween_manager_o *manager, uint32_t slot, uint32_t i)
+{
+    const float v = manager->cache_values ? manager->values[i] : evaluate(manager, i);
+    const uint32_t playhead = manager->slots[slot].playhead;
+    return playhead == TWEEN_NO_SLOT ? v : sample_timeline(manager, manager->playheads + playhead, v);
+}
+
+// Number of floats in the value of the tween at slot `slot`.
+static uint32_t num_components(const tm_tween_manager_o *manager, uint32_t slot)
+{
+    const uint32_t vector = manager->slots[slot].vector;
+    if (vector == TWEEN_NO_SLOT)
+        return 1;
+
+    const uint32_t type = manager->vectors[vector].type;
+    return type == TM_TWEEN_VALUE_TYPE_VEC2 ? 2 : type == TM_TWEEN_VALUE_TYPE_VEC3 ? 3 : 4;
+}
+
+// Writes the value of the tween at slot `slot` and dense index `i` to `res` and returns its
+// number of components.
+static uint32_t value_at(const tm_tween_manager_o *manager, uint32_t slot, uint32_t i, float *res)
+{
+    const float e = tween_value(manager, slot, i);
+    const uint32_t vector = manager->slots[slot].vector;
+    if (vector == TWEEN_NO_SLOT)
+    {
+        res[0] = e;
+        return 1;
+    }
+
+    interpolate_vector(&manager->vectors[vector], e, res);
+    return num_components(manager, slot);
+}
+
+// Reads the current value of `tween` into `res` and returns its number of components, 0 if the
+// handle is stale. The lookup is counted into `lookup_counters[counters]`.
+static uint32_t read_value(tm_tween_manager_o *manager, uint32_t counters, tm_tween_t tween, float *res)
+{
+    uint32_t i;
+    if (!counted_lookup(manager, counters, tween, &i))
+        return 0;
+
+    return value_at(manager, tween.index, i, res);
+}
+
+// Writes the value of every live tween to the unpublished snapshot buffer and publishes it. If a
+// reader that pinned that buffer while it was last published hasn't left it yet, which a reader
+// thread descheduled mid-read can make take arbitrarily long, the update skips publishing instead
+// of waiting and the current snapshot stays published one more update. Neither side ever waits.
+static void publish_snapshot(tm_tween_manager_o *manager)
+{
+    const uint32_t front = (uint32_t)(atomic_load_uint64_t(&manager->snapshot_state) >> 32);
+    tween_snapshot_t *back = manager->snapshots + (front ^ 1);
+    if (atomic_load_uint32_t(&back->egress) != back->ingress)
+        return;
+
+    atomic_store_uint32_t(&back->egress, 0);
+    back->ingress = 0;
+
+    const uint32_t num_slots = (uint32_t)tm_carray_size(manager->slots);
+    tm_carray_resize(back->entries, num_slots, &manager->counting_allocator);
+    memset(back->entries, 0, num_slots * sizeof(*back->entries));
+    for (uint32_t i = 0; i < manager->num_tweens; ++i)
+    {
+        tween_snapshot_entry_t *e = back->entries + manager->handle[i].index;
+        e->generation = manager->handle[i].generation;
+        value_at(manager, manager->handle[i].index, i, e->value);
+    }
+
+    const uint64_t old = atomic_exchange_uint64_t(&manager->snapshot_state, (uint64_t)(front ^ 1) << 32);
+    manager->snapshots[front].ingress = (uint32_t)old;
+}
+
+// Publishes the counters of the frame ending with this update and starts counting the next one.
+static void publish_stats(tm_tween_manager_o *manager)
+{
+    tm_tween_stats_t *stats = &manager->frame_stats;
+    stats->num_active = manager->num_tweens;
+    stats->num_finished = (uint32_t)tm_carray_size(manager->job.finished_handles);
+    for (uint32_t c = 0; c < TWEEN_COUNTERS__COUNT; ++c)
+    {
+        stats->num_lookups += manager->lookup_counters[c].lookups;
+        stats->num_lookup_misses += manager->lookup_counters[c].misses;
+    }
+    stats->allocated_bytes = manager->allocation_stats.allocated_bytes;
+
+    manager->stats = *stats;
+    *stats = (tm_tween_stats_t){ 0 };
+    memset(manager->lookup_counters, 0, sizeof(manager->lookup_counters));
+}
+
+static void tween_update(struct tm_entity_context_o *ctx, tm_entity_system_o *inst, struct tm_entity_commands_o *commands)
+{
+    const double dt = tm_entity_api->get_blackboard_double(ctx, TM_ENTITY_BB__DELTA_TIME, 1.0 / 60.0);
+    const double editor = tm_entity_api->get_blackboard_double(ctx, TM_ENTITY_BB__EDITOR, 0.0);
+    if (editor) return;
+
+    TM_PROFILER_BEGIN_FUNC_SCOPE();
+
+    tm_tween_manager_o *manager = (tm_tween_manager_o *)inst;
+
+    TM_PROFILER_BEGIN_LOCAL_SCOPE(tween_commands);
+    run_commands(manager);
+    TM_PROFILER_END_LOCAL_SCOPE(tween_commands);
+
+    if (manager->scheduler.parallel_for && manager->num_tweens >= manager->parallel_threshold)
+        update_parallel(manager, dt);
+    else
+        update_serial(manager, dt);
+
+    if (manager->snapshot_enabled)
+    {
+        TM_PROFILER_BEGIN_LOCAL_SCOPE(tween_publish_snapshot);
+        publish_snapshot(manager);
+        TM_PROFILER_END_LOCAL_SCOPE(tween_publish_snapshot);
+    }
+
+    publish_stats(manager);
+
+    TM_PROFILER_END_FUNC_SCOPE();
+}
+
+static void tween_shutdown(struct tm_entity_context_o *ctx, tm_entity_system_o *inst, struct tm_entity_commands_o *commands)
+{
+    tm_tween_manager_o *manager = (tm_tween_manager_o *)inst;
+
+    tm_tween_manager_o **link = &managers;
+    while (*link != manager)
+        link = &(*link)->next;
+    *link = manager->next;
+
+    if (tm_tween_api->manager == manager)
+        tm_tween_api->manager = managers;
+    if (thread_manager == manager)
+        thread_manager = NULL;
+
+    set_capacity(manager, 0);
+    tm_carray_free(manager->slots, &manager->counting_allocator);
+    tm_carray_free(manager->vectors, &manager->counting_allocator);
+    tm_carray_free(manager->timelines, &manager->counting_allocator);
+    tm_carray_free(manager->keyframes, &manager->counting_allocator);
+    tm_carray_free(manager->playheads, &manager->counting_allocator);
+    tm_carray_free(manager->successors, &manager->counting_allocator);
+    for (tween_group_t *g = manager->groups; g != tm_carray_end(manager->groups); ++g)
+        tm_carray_free(g->deadlines, &manager->counting_allocator);
+    tm_carray_free(manager->groups, &manager->counting_allocator);
+    tm_carray_free(manager->job.expired, &manager->counting_allocator);
+    tm_carray_free(manager->job.finished, &manager->counting_allocator);
+    tm_carray_free(manager->job.finished_handles, &manager->counting_allocator);
+    tm_carray_free(manager->job.due, &manager->counting_allocator);
+    tm_carray_free(manager->job.edge_words, &manager->counting_allocator);
+    tm_carray_free(manager->job.eval_items, &manager->counting_allocator);
+    tm_carray_free(manager->job_decls, &manager->counting_allocator);
+    tm_carray_free(manager->job_items, &manager->counting_allocator);
+    tm_free(&manager->counting_allocator, manager->commands, TWEEN_COMMAND_QUEUE_SIZE * sizeof(*manager->commands));
+    tm_free(&manager->counting_allocator, manager->reserve_ring, TWEEN_RESERVE_RING_SIZE * sizeof(*manager->reserve_ring));
+    tm_carray_free(manager->snapshots[0].entries, &manager->counting_allocator);
+    tm_carray_free(manager->snapshots[1].entries, &manager->counting_allocator);
+
+    tm_allocator_i a = manager->allocator;
+    tm_free(&a, manager, sizeof(*manager));
+    tm_entity_api->destroy_child_allocator(ctx, &a);
+}
+
+static void create_tween_component(struct tm_entity_context_o *ctx)
+{
+    const tm_component_i component = {
+        .name = TM_TT_TYPE__TWEEN_COMPONENT,
+        .bytes = sizeof(tm_tween_component_t),
+    };
+    tm_entity_api->register_component(ctx, &component);
+}
+
+// Writes position and scale bindings, visiting entities in archetype order.
+static void transform_engine_update(tm_engine_o *inst, tm_engine_update_set_t *data, struct tm_entity_commands_o *commands)
+{
+    TM_PROFILER_BEGIN_FUNC_SCOPE();
+
+    tm_tween_manager_o *manager = (tm_tween_manager_o *)inst;
+
+    for (const tm_engine_update_array_t *a = data->arrays; a < data->arrays + data->num_arrays; ++a)
+    {
+        const tm_tween_component_t *tweens = a->components[0];
+        tm_transform_component_t *transforms = a->components[1];
+
+        for (uint32_t e = 0; e < a->n; ++e)
+        {
+            bool changed = false;
+            for (const tm_tween_binding_t *b = tweens[e].bindings; b < tweens[e].bindings + tweens[e].num_bindings; ++b)
+            {
+                if (b->target == TM_TWEEN_TARGET_MEMBER)
+                    continue;
+
+                float value[4];
+                const uint32_t n = read_value(manager, TWEEN_COUNTERS__TRANSFORM_ENGINE, b->tween, value);
+                if (!n)
+                    continue;
+
+                float *dst = b->target == TM_TWEEN_TARGET_POSITION ? &transforms[e].local.pos.x : &transforms[e].local.scale.x;
+                for (uint32_t c = 0; c < 3; ++c)
+                    dst[c] = n == 1 ? value[0] : c < n ? value[c] : dst[c];
+                changed = true;
+            }
+
+            if (changed)
+                ++transforms[e].version;
+        }
+    }
+
+    TM_PROFILER_END_FUNC_SCOPE();
+}
+
+// Writes member bindings and drops the bindings of tweens that are gone. Member bindings can write
+// any component, so this engine runs exclusively.
+static void member_engine_update(tm_engine_o *inst, tm_engine_update_set_t *data, struct tm_entity_commands_o *commands)
+{
+    TM_PROFILER_BEGIN_FUNC_SCOPE();
+
+    tm_tween_manager_o *manager = (tm_tween_manager_o *)inst;
+
+    for (const tm_engine_update_array_t *a = data->arrays; a < data->arrays + data->num_arrays; ++a)
+    {
+        tm_tween_component_t *tweens = a->components[0];
+
+        for (uint32_t e = 0; e < a->n; ++e)
+        {
+            tm_tween_component_t *c = tweens + e;
+            for (uint32_t b = 0; b < c->num_bindings;)
+            {
+                const tm_tween_binding_t *binding = c->bindings + b;
+
+                float value[4];
+                const uint32_t n = read_value(manager, TWEEN_COUNTERS__MEMBER_ENGINE, binding->tween, value);
+                if (!n)
+                {
+                    c->bindings[b] = c->bindings[--c->num_bindings];
+                    continue;
+                }
+
+                if (binding->target == TM_TWEEN_TARGET_MEMBER)
+                {
+                    uint8_t *component = tm_entity_api->get_component(manager->ctx, a->entities[e], binding->component);
+                    if (component && (uint64_t)binding->offset + n * sizeof(float) <= binding->component_bytes)
+                        memcpy(component + binding->offset, value, n * sizeof(float));
+                }
+                ++b;
+            }
+        }
+    }
+
+    TM_PROFILER_END_FUNC_SCOPE();
+}
+
+static void register_tween_system(struct tm_entity_context_o *ctx)
+{
+    tm_allocator_i a;
+    tm_entity_api->create_child_allocator(ctx, TM_TT_TYPE__GRAPH_COMPONENT, &a);
+
+    tm_tween_manager_o * manager = tm_alloc(&a, sizeof(*manager));
+    *(manager) = (tm_tween_manager_o){
+        .ctx = ctx,
+        .allocator = a,
+        .first_free_slot = TWEEN_NO_SLOT,
+        .first_free_vector = TWEEN_NO_SLOT,
+        .first_free_playhead = TWEEN_NO_SLOT,
+        .first_free_successor = TWEEN_NO_SLOT,
+        .parallel_threshold = TWEEN_DEFAULT_PARALLEL_THRESHOLD,
+    };
+    manager->counting_allocator = (tm_allocator_i){ .inst = (tm_allocator_o *)manager, .realloc = counting_realloc };
+    manager->job.manager = manager;
+    add_group(manager, (tm_strhash_t){ 0 }, 0);
+
+    manager->commands = tm_alloc(&manager->counting_allocator, TWEEN_COMMAND_QUEUE_SIZE * sizeof(*manager->commands));
+    for (uint32_t c = 0; c < TWEEN_COMMAND_QUEUE_SIZE; ++c)
+        manager->commands[c].sequence = c;
+    manager->reserve_ring = tm_alloc(&manager->counting_allocator, TWEEN_RESERVE_RING_SIZE * sizeof(*manager->reserve_ring));
+    if (tm_job_system_api)
+        manager->scheduler = (tm_tween_scheduler_i){ .inst = manager, .parallel_for = job_system_parallel_for };
+    manager->next = managers;
+    managers = manager;
+    tm_tween_api->manager = manager;
+
+    const tm_entity_system_i tween_system = {
+        .ui_name = TM_TWEEN_SYSTEM,
+        .hash = TM_TWEEN_SYSTEM_HASH,
+        .init = tween_init,
+        .update = tween_update,
+        .shutdown = tween_shutdown,
+        .inst = (tm_entity_system_o *)manager,
+    };
+    tm_entity_api->register_system(ctx, &tween_system);
+
+    manager->tween_component = tm_entity_api->lookup_component_type(ctx, TM_TT_TYPE_HASH__TWEEN_COMPONENT);
+    manager->transform_component = tm_entity_api->lookup_component_type(ctx, TM_TT_TYPE_HASH__TRANSFORM_COMPONENT);
+
+    const tm_engine_i transform_engine = {
+        .ui_name = TM_TWEEN_TRANSFORM_ENGINE,
+        .hash = TM_TWEEN_TRANSFORM_ENGINE_HASH,
+        .num_components = 2,
+        .components = { manager->tween_component, manager->transform_component },
+        .writes = { false, true },
+        .before_me = { TM_TWEEN_SYSTEM_HASH },
+        .update = transform_engine_update,
+        .inst = (tm_engine_o *)manager,
+    };
+    tm_entity_api->register_engine(ctx, &transform_engine);
+
+    const tm_engine_i member_engine = {
+        .ui_name = TM_TWEEN_MEMBER_ENGINE,
+        .hash = TM_TWEEN_MEMBER_ENGINE_HASH,
+        .exclusive = true,
+        .num_components = 1,
+        .components = { manager->tween_component },
+        .writes = { true },
+        .before_me = { TM_TWEEN_SYSTEM_HASH, TM_TWEEN_TRANSFORM_ENGINE_HASH },
+        .update = member_engine_update,
+        .inst = (tm_engine_o *)manager,
+    };
+    tm_entity_api->register_engine(ctx, &member_engine);
+}
+
+static inline void get_tween_variable(tm_graph_interpreter_context_t *ctx, tm_string_hash_t name, tm_tween_t *value)
+{
+    tm_graph_interpreter_wire_content_t var_w = tm_graph_interpreter_api->read_variable(ctx->interpreter, name);
+    if (var_w.n)
+        *value = *(tm_tween_t *)var_w.data;
+}
+
+static inline void set_tween_variable(tm_graph_interpreter_context_t *ctx, tm_string_hash_t name, tm_tween_t value)
+{
+    tm_tween_t *var = tm_graph_interpreter_api->write_variable(ctx->interpreter, name, 1, sizeof(*var));
+    *var = value;
+}
+
+// NODES
+
+// Graph variable holding the entity context of the graph component running the graph.
+#define TWEEN_GRAPH_VARIABLE__CONTEXT TM_STATIC_HASH("__context", 0x8642d282ee750e24ULL)
+
+// Makes the API functions called by a node use the tween manager of the node's entity context.
+// Returns the manager to restore afterwards.
+static tm_tween_manager_o *bind_node_manager(tm_graph_interpreter_context_t *ctx)
+{
+    tm_tween_manager_o *previous = thread_manager;
+    const tm_graph_interpreter_wire_content_t context_w = tm_graph_interpreter_api->read_variable(ctx->interpreter, TM_STRHASH_U64(TWEEN_GRAPH_VARIABLE__CONTEXT));
+    tm_tween_manager_o *manager = context_w.n ? find_manager(*(tm_entity_context_o **)context_w.data) : NULL;
+    if (manager)
+        thread_manager = manager;
+    return previous;
+}
+
+// Defines `run_##f()`, running the node function `f` with the tween manager of the node's entity
+// context and in a profiler scope named after `f`.
+#define TWEEN_NODE_RUN(f)                                          \
+    static void run_##f(tm_graph_interpreter_context_t *ctx)       \
+    {                                                              \
+        TM_PROFILER_BEGIN_LOCAL_SCOPE(f);                          \
+        tm_tween_manager_o *previous = bind_node_manager(ctx);     \
+        f(ctx);                                                    \
+        thread_manager = previous;                                 \
+        TM_PROFILER_END_LOCAL_SCOPE(f);                            \
+    }
+
+//----------------------------------------------------
+enum {
+    TWEEN_CREATE__IN_WIRE,
+    TWEEN_CREATE__FROM,
+    TWEEN_CREATE__TO,
+    TWEEN_CREATE__DURATION,
+    TWEEN_CREATE__EASING,
+    TWEEN_CREATE__OUT_WIRE,
+    TWEEN_CREATE__OUT_TWEEN,
+};
+
+static const tm_graph_generic_value_t tween_from_default_value = { .f = (float[1]){ 0 } };
+static const tm_graph_generic_value_t tween_to_default_value = { .f = (float[1]){ 1 } };
+static const tm_graph_generic_value_t tween_duration_default_value = { .f = (float[1]){ 1 } };
+
+static void tween_create_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t from_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__FROM]);
+    const tm_graph_interpreter_wire_content_t to_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__TO]);
+    const tm_graph_interpreter_wire_content_t duration_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__DURATION]);
+    const tm_graph_interpreter_wire_content_t easing_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__EASING]);
+
+    const float from = from_w.n > 0 ? *(float *)from_w.data : *tween_from_default_value.f;
+    const float to = to_w.n > 0 ? *(float *)to_w.data : *tween_to_default_value.f;
+    const float duration = duration_w.n > 0 ? *(float *)duration_w.data : *tween_duration_default_value.f;
+    const uint32_t easing = easing_w.n > 0 ? *(uint32_t *)easing_w.data : TM_TWEEN_EASING_ITEM_LINEAR;
+
+    tm_tween_t *v = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__OUT_TWEEN], 1, sizeof(tm_tween_t));
+    *v = tm_tween_api->create(from, to, duration, easing);
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__OUT_WIRE]);
+}
+
+TWEEN_NODE_RUN(tween_create_f)
+
+static tm_graph_component_node_type_i tween_create_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_create",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "from", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_from_default_value },
+        { "to", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_to_default_value },
+        { "duration", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_duration_default_value },
+        { "easing", TM_TT_TYPE_HASH__UINT32_T, TM_TT_TYPE_HASH__EASING_ITEM },
+    },
+    .static_connectors.num_in = 5,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_out = 2,
+    .run = run_tween_create_f,
+};
+
+//----------------------------------------------------
+enum {
+    TWEEN_DESTROY__IN_WIRE,
+    TWEEN_DESTROY__TWEEN,
+    TWEEN_DESTROY__OUT_WIRE,
+};
+
+static void tween_destroy_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_DESTROY__TWEEN]);
+
+    if (tween_w.n == 0)
+        return;
+
+    const tm_tween_t tween = *(tm_tween_t *)tween_w.data;
+    tm_tween_api->destroy(tween);
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[TWEEN_DESTROY__OUT_WIRE]);
+}
+
+TWEEN_NODE_RUN(tween_destroy_f)
+
+static tm_graph_component_node_type_i tween_destroy_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_destroy",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_in = 2,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_destroy_f,
+};
+//----------------------------------------------------
+enum {
+    TWEEN_CREATE_MANY__IN_WIRE,
+    TWEEN_CREATE_MANY__FROM,
+    TWEEN_CREATE_MANY__TO,
+    TWEEN_CREATE_MANY__DURATION,
+    TWEEN_CREATE_MANY__EASING,
+    TWEEN_CREATE_MANY__COUNT,
+    TWEEN_CREATE_MANY__GROUP,
+    TWEEN_CREATE_MANY__OUT_WIRE,
+    TWEEN_CREATE_MANY__OUT_TWEENS,
+};
+
+static const uint32_t tween_easing_default_value = TM_TWEEN_EASING_ITEM_LINEAR;
+
+// Returns the first `n` elements of size `size` of the wire content `w`. If it has fewer, returns
+// a copy in `ta` padded with its last element, or with `def` if it is empty.
+static const void *wire_elements(tm_temp_allocator_i *ta, tm_graph_interpreter_wire_content_t w, const void *def, uint32_t size, uint32_t n)
+{
+    if (w.n >= n)
+        return w.data;
+
+    uint8_t *res = tm_temp_alloc(ta, (uint64_t)n * size);
+    const uint8_t *pad = w.n ? (const uint8_t *)w.data + (w.n - 1) * size : def;
+    if (w.n)
+        memcpy(res, w.data, w.n * size);
+    for (uint32_t k = w.n; k < n; ++k)
+        memcpy(res + k * size, pad, size);
+    return res;
+}
+
+// Creates as many tweens as `count` or the longest of `from`, `to`, `duration` and `easing`,
+// whichever is larger, with one call to `create_many()`. Shorter inputs repeat their last element.
+static void tween_create_many_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t from_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_MANY__FROM]);
+    const tm_graph_interpreter_wire_content_t to_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_MANY__TO]);
+    const tm_graph_interpreter_wire_content_t duration_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_MANY__DURATION]);
+    const tm_graph_interpreter_wire_content_t easing_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_MANY__EASING]);
+    const tm_graph_interpreter_wire_content_t count_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_MANY__COUNT]);
+    const tm_graph_interpreter_wire_content_t group_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_MANY__GROUP]);
+
+    uint32_t n = count_w.n > 0 ? *(uint32_t *)count_w.data : 0;
+    n = from_w.n > n ? from_w.n : n;
+    n = to_w.n > n ? to_w.n : n;
+    n = duration_w.n > n ? duration_w.n : n;
+    n = easing_w.n > n ? easing_w.n : n;
+    const tm_string_hash_t group = group_w.n > 0 ? *(tm_string_hash_t *)group_w.data : 0;
+
+    TM_INIT_TEMP_ALLOCATOR(ta);
+    const float *from = wire_elements(ta, from_w, tween_from_default_value.f, sizeof(float), n);
+    const float *to = wire_elements(ta, to_w, tween_to_default_value.f, sizeof(float), n);
+    const float *duration = wire_elements(ta, duration_w, tween_duration_default_value.f, sizeof(float), n);
+    const uint32_t *easing = wire_elements(ta, easing_w, &tween_easing_default_value, sizeof(uint32_t), n);
+
+    tm_tween_t *tweens = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_MANY__OUT_TWEENS], n, sizeof(tm_tween_t));
+    if (!tm_tween_api->create_many(from, to, duration, easing, n, TM_STRHASH(group), tweens))
+        memset(tweens, 0, n * sizeof(tm_tween_t));
+    TM_SHUTDOWN_TEMP_ALLOCATOR(ta);
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_MANY__OUT_WIRE]);
+}
+
+TWEEN_NODE_RUN(tween_create_many_f)
+
+static tm_graph_component_node_type_i tween_create_many_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_create_many",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "from", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_from_default_value },
+        { "to", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_to_default_value },
+        { "duration", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_duration_default_value },
+        { "easing", TM_TT_TYPE_HASH__UINT32_T, TM_TT_TYPE_HASH__EASING_ITEM },
+        { "count", TM_TT_TYPE_HASH__UINT32_T, .optional = true },
+        { "group", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING, .optional = true },
+    },
+    .static_connectors.num_in = 7,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tweens", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_out = 2,
+    .run = run_tween_create_many_f,
+};
+//----------------------------------------------------
+enum {
+    TWEEN_DESTROY_MANY__IN_WIRE,
+    TWEEN_DESTROY_MANY__TWEENS,
+    TWEEN_DESTROY_MANY__OUT_WIRE,
+};
+
+static void tween_destroy_many_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tweens_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_DESTROY_MANY__TWEENS]);
+
+    tm_tween_api->destroy_many(tweens_w.data, tweens_w.n);
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[TWEEN_DESTROY_MANY__OUT_WIRE]);
+}
+
+TWEEN_NODE_RUN(tween_destroy_many_f)
+
+static tm_graph_component_node_type_i tween_destroy_many_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_destroy_many",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tweens", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_in = 2,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_destroy_many_f,
+};
+//----------------------------------------------------
+enum {
+    TWEEN_GET_FLOAT_MANY__TWEENS,
+    TWEEN_GET_FLOAT_MANY__OUT_VALUES,
+};
+
+static void tween_get_float_many_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tweens_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_GET_FLOAT_MANY__TWEENS]);
+
+    float *values = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_GET_FLOAT_MANY__OUT_VALUES], tweens_w.n, sizeof(*values));
+    tm_tween_api->get_float_many(tweens_w.data, tweens_w.n, values);
+}
+
+TWEEN_NODE_RUN(tween_get_float_many_f)
+
+static tm_graph_component_node_type_i tween_get_float_many_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_get_float_many",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "tweens", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_in = 1,
+    .static_connectors.out = {
+        { "values", TM_TT_TYPE_HASH__FLOAT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_get_float_many_f,
+};
+//----------------------------------------------------
+enum {
+    TWEEN_IS_RUNNING__TWEEN,
+    TWEEN_IS_RUNNING__OUT_IS_RUNNING,
+};
+
+static void tween_is_running_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_IS_RUNNING__TWEEN]);
+
+    if (tween_w.n == 0)
+        return;
+
+    const tm_tween_t tween = *(tm_tween_t *)tween_w.data;
+    bool *is_running = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_IS_RUNNING__OUT_IS_RUNNING], 1, sizeof(*is_running));
+
+    uint32_t i;
+    *is_running = counted_lookup(current_manager(), TWEEN_COUNTERS__API, tween, &i);
+}
+
+TWEEN_NODE_RUN(tween_is_running_f)
+
+static tm_graph_component_node_type_i tween_is_running_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_is_running",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_in = 1,
+    .static_connectors.out = {
+        { "is running", TM_TT_TYPE_HASH__BOOL },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_is_running_f,
+};
+//----------------------------------------------------
+enum {
+    ON_TWEEN_FINISHED__IN_EVENT,
+    ON_TWEEN_FINISHED__TWEEN,
+    ON_TWEEN_FINISHED__OUT_EVENT,
+    ON_TWEEN_FINISHED__OUT_TWEEN,
+};
+
+// Fires once for every tween in the completion queue, or only for `tween` when it is connected.
+static void on_tween_finished_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[ON_TWEEN_FINISHED__TWEEN]);
+
+    const tm_tween_t *finished;
+    const uint32_t num_finished = tm_tween_api->finished(&finished);
+    for (uint32_t f = 0; f < num_finished; ++f)
+    {
+        if (tween_w.n > 0 && ((tm_tween_t *)tween_w.data)->u64 != finished[f].u64)
+            continue;
+
+        tm_tween_t *v = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[ON_TWEEN_FINISHED__OUT_TWEEN], 1, sizeof(tm_tween_t));
+        *v = finished[f];
+        tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[ON_TWEEN_FINISHED__OUT_EVENT]);
+    }
+}
+
+TWEEN_NODE_RUN(on_tween_finished_f)
+
+static tm_graph_component_node_type_i on_tween_finished_node = {
+    .definition_path = __FILE__,
+    .name = "tm_on_tween_finished",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM, .optional = true },
+    },
+    .static_connectors.num_in = 2,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_out = 2,
+    .run = run_on_tween_finished_f,
+};
+//----------------------------------------------------
+enum {
+    TWEEN_IS_PAUSED__TWEEN,
+    TWEEN_IS_PAUSED__OUT_IS_PAUSED,
+};
+
+static void tween_is_paused_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_IS_PAUSED__TWEEN]);
+
+    if (tween_w.n == 0)
+        return;
+
+    const tm_tween_t tween = *(tm_tween_t *)tween_w.data;
+    bool *is_paused = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_IS_PAUSED__OUT_IS_PAUSED], 1, sizeof(*is_paused));
+
+    tm_tween_manager_o *manager = current_manager();
+    uint32_t i;
+    if (counted_lookup(manager, TWEEN_COUNTERS__API, tween, &i))
+    {
+        *is_paused = paused_bit(manager, i);
+    }
+    else
+    {
+        *is_paused = false;
+    }
+}
+
+TWEEN_NODE_RUN(tween_is_paused_f)
+
+static tm_graph_component_node_type_i tween_is_paused_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_is_paused",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_in = 1,
+    .static_connectors.out = {
+        { "is paused", TM_TT_TYPE_HASH__BOOL },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_is_paused_f,
+};
+//----------------------------------------------------
+enum {
+    PAUSE_TWEEN__IN_EVENT,
+    PAUSE_TWEEN__TWEEN,
+    PAUSE_TWEEN__PAUSE,
+    PAUSE_TWEEN__OUT_EVENT,
+};
+
+static const tm_graph_generic_value_t tween_pause_default_value = { .boolean = (bool[1]){ false } };
+
+static void tween_pause_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[PAUSE_TWEEN__TWEEN]);
+    const tm_graph_interpreter_wire_content_t pause_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[PAUSE_TWEEN__PAUSE]);
+
+    if (tween_w.n == 0)
+        return;
+
+    const tm_tween_t tween = *(tm_tween_t *)tween_w.data;
+    const bool pause = pause_w.n > 0 ? *(bool *)pause_w.data : *tween_pause_default_value.boolean;
+
+    tm_tween_manager_o *manager = current_manager();
+    uint32_t i;
+    if (counted_lookup(manager, TWEEN_COUNTERS__API, tween, &i))
+    {
+        set_paused(manager, i, pause);
+    }
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[PAUSE_TWEEN__OUT_EVENT]);
+}
+
+TWEEN_NODE_RUN(tween_pause_f)
+
+static tm_graph_component_node_type_i pause_tween_node = {
+    .definition_path = __FILE__,
+    .name = "tm_pause_tween",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+        { "pause", TM_TT_TYPE_HASH__BOOL },
+    },
+    .static_connectors.num_in = 3,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_pause_f,
+};
+//----------------------------------------------------
+enum {
+    TWEEN_THEN__IN_EVENT,
+    TWEEN_THEN__TWEEN,
+    TWEEN_THEN__NEXT,
+    TWEEN_THEN__OUT_EVENT,
+};
+
+static void tween_then_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_THEN__TWEEN]);
+    const tm_graph_interpreter_wire_content_t next_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_THEN__NEXT]);
+
+    if (tween_w.n == 0 || next_w.n == 0)
+        return;
+
+    tm_tween_api->then(*(tm_tween_t *)tween_w.data, *(tm_tween_t *)next_w.data);
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[TWEEN_THEN__OUT_EVENT]);
+}
+
+TWEEN_NODE_RUN(tween_then_f)
+
+static tm_graph_component_node_type_i tween_then_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_then",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+        { "next", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_in = 3,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_then_f,
+};
+//----------------------------------------------------
+enum {
+    TWEEN_SET_REPEAT__IN_EVENT,
+    TWEEN_SET_REPEAT__TWEEN,
+    TWEEN_SET_REPEAT__REPEATS,
+    TWEEN_SET_REPEAT__YOYO,
+    TWEEN_SET_REPEAT__OUT_EVENT,
+};
+
+static const uint32_t tween_repeats_default_value = TM_TWEEN_REPEAT_FOREVER;
+static const tm_graph_generic_value_t tween_yoyo_default_value = { .boolean = (bool[1]){ false } };
+
+// Sets the repeats of every tween on the `tween` wire, so the output of `tm_tween_create_many`
+// can be looped in one go. Loops forever when `repeats` is not connected.
+static void tween_set_repeat_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_SET_REPEAT__TWEEN]);
+    const tm_graph_interpreter_wire_content_t repeats_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_SET_REPEAT__REPEATS]);
+    const tm_graph_interpreter_wire_content_t yoyo_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_SET_REPEAT__YOYO]);
+
+    const uint32_t repeats = repeats_w.n > 0 ? *(uint32_t *)repeats_w.data : tween_repeats_default_value;
+    const bool yoyo = yoyo_w.n > 0 ? *(bool *)yoyo_w.data : *tween_yoyo_default_value.boolean;
+
+    const tm_tween_t *tweens = tween_w.data;
+    for (uint32_t k = 0; k < tween_w.n; ++k)
+        tm_tween_api->set_repeat(tweens[k], repeats, yoyo ? TM_TWEEN_REPEAT_YOYO : TM_TWEEN_REPEAT_RESTART);
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[TWEEN_SET_REPEAT__OUT_EVENT]);
+}
+
+TWEEN_NODE_RUN(tween_set_repeat_f)
+
+static tm_graph_component_node_type_i tween_set_repeat_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_set_repeat",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+        { "repeats", TM_TT_TYPE_HASH__UINT32_T, .optional = true },
+        { "yoyo", TM_TT_TYPE_HASH__BOOL },
+    },
+    .static_connectors.num_in = 4,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_set_repeat_f,
+};
+//----------------------------------------------------
+enum {
+    CREATE_TWEEN_GROUP__IN_EVENT,
+    CREATE_TWEEN_GROUP__NAME,
+    CREATE_TWEEN_GROUP__PARENT,
+    CREATE_TWEEN_GROUP__OUT_EVENT,
+};
+
+static void tween_create_group_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t name_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[CREATE_TWEEN_GROUP__NAME]);
+    const tm_graph_interpreter_wire_content_t parent_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[CREATE_TWEEN_GROUP__PARENT]);
+
+    if (name_w.n == 0)
+        return;
+
+    const tm_string_hash_t name = *(tm_string_hash_t *)name_w.data;
+    const tm_string_hash_t parent = parent_w.n > 0 ? *(tm_string_hash_t *)parent_w.data : 0;
+
+    tm_tween_api->create_group(TM_STRHASH(name), TM_STRHASH(parent));
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[CREATE_TWEEN_GROUP__OUT_EVENT]);
+}
+
+TWEEN_NODE_RUN(tween_create_group_f)
+
+static tm_graph_component_node_type_i create_tween_group_node = {
+    .definition_path = __FILE__,
+    .name = "tm_create_tween_group",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "name", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING },
+        { "parent", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING, .optional = true },
+    },
+    .static_connectors.num_in = 3,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_create_group_f,
+};
+//----------------------------------------------------
+enum {
+    SET_TWEEN_GROUP__IN_EVENT,
+    SET_TWEEN_GROUP__TWEEN,
+    SET_TWEEN_GROUP__GROUP,
+    SET_TWEEN_GROUP__OUT_EVENT,
+};
+
+static void tween_set_group_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[SET_TWEEN_GROUP__TWEEN]);
+    const tm_graph_interpreter_wire_content_t group_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[SET_TWEEN_GROUP__GROUP]);
+
+    if (tween_w.n == 0)
+        return;
+
+    const tm_tween_t tween = *(tm_tween_t *)tween_w.data;
+    const tm_string_hash_t group = group_w.n > 0 ? *(tm_string_hash_t *)group_w.data : 0;
+
+    tm_tween_api->set_group(tween, TM_STRHASH(group));
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[SET_TWEEN_GROUP__OUT_EVENT]);
+}
+
+TWEEN_NODE_RUN(tween_set_group_f)
+
+static tm_graph_component_node_type_i set_tween_group_node = {
+    .definition_path = __FILE__,
+    .name = "tm_set_tween_group",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+        { "group", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING },
+    },
+    .static_connectors.num_in = 3,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_set_group_f,
+};
+//----------------------------------------------------
+enum {
+    PAUSE_TWEEN_GROUP__IN_EVENT,
+    PAUSE_TWEEN_GROUP__GROUP,
+    PAUSE_TWEEN_GROUP__PAUSE,
+    PAUSE_TWEEN_GROUP__OUT_EVENT,
+};
+
+static void tween_pause_group_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t group_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[PAUSE_TWEEN_GROUP__GROUP]);
+    const tm_graph_interpreter_wire_content_t pause_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[PAUSE_TWEEN_GROUP__PAUSE]);
+
+    const tm_string_hash_t group = group_w.n > 0 ? *(tm_string_hash_t *)group_w.data : 0;
+    const bool pause = pause_w.n > 0 ? *(bool *)pause_w.data : *tween_pause_default_value.boolean;
+
+    tm_tween_api->set_group_paused(TM_STRHASH(group), pause);
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[PAUSE_TWEEN_GROUP__OUT_EVENT]);
+}
+
+TWEEN_NODE_RUN(tween_pause_group_f)
+
+static tm_graph_component_node_type_i pause_tween_group_node = {
+    .definition_path = __FILE__,
+    .name = "tm_pause_tween_group",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "group", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING },
+        { "pause", TM_TT_TYPE_HASH__BOOL },
+    },
+    .static_connectors.num_in = 3,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_pause_group_f,
+};
+//----------------------------------------------------
+enum {
+    SET_TWEEN_GROUP_TIME_SCALE__IN_EVENT,
+    SET_TWEEN_GROUP_TIME_SCALE__GROUP,
+    SET_TWEEN_GROUP_TIME_SCALE__TIME_SCALE,
+    SET_TWEEN_GROUP_TIME_SCALE__OUT_EVENT,
+};
+
+static const tm_graph_generic_value_t tween_time_scale_default_value = { .f = (float[1]){ 1 } };
+
+static void tween_set_group_time_scale_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t group_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[SET_TWEEN_GROUP_TIME_SCALE__GROUP]);
+    const tm_graph_interpreter_wire_content_t time_scale_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[SET_TWEEN_GROUP_TIME_SCALE__TIME_SCALE]);
+
+    const tm_string_hash_t group = group_w.n > 0 ? *(tm_string_hash_t *)group_w.data : 0;
+    const float time_scale = time_scale_w.n > 0 ? *(float *)time_scale_w.data : *tween_time_scale_default_value.f;
+
+    tm_tween_api->set_group_time_scale(TM_STRHASH(group), time_scale);
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[SET_TWEEN_GROUP_TIME_SCALE__OUT_EVENT]);
+}
+
+TWEEN_NODE_RUN(tween_set_group_time_scale_f)
+
+static tm_graph_component_node_type_i set_tween_group_time_scale_node = {
+    .definition_path = __FILE__,
+    .name = "tm_set_tween_group_time_scale",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "group", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING },
+        { "time scale", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_time_scale_default_value },
+    },
+    .static_connectors.num_in = 3,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_set_group_time_scale_f,
+};
+//----------------------------------------------------
+enum {
+    DESTROY_TWEEN_GROUP_TWEENS__IN_EVENT,
+    DESTROY_TWEEN_GROUP_TWEENS__GROUP,
+    DESTROY_TWEEN_GROUP_TWEENS__OUT_EVENT,
+};
+
+static void tween_destroy_group_tweens_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t group_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[DESTROY_TWEEN_GROUP_TWEENS__GROUP]);
+
+    if (group_w.n == 0)
+        return;
+
+    const tm_string_hash_t group = *(tm_string_hash_t *)group_w.data;
+
+    tm_tween_api->destroy_group_tweens(TM_STRHASH(group));
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[DESTROY_TWEEN_GROUP_TWEENS__OUT_EVENT]);
+}
+
+TWEEN_NODE_RUN(tween_destroy_group_tweens_f)
+
+static tm_graph_component_node_type_i destroy_tween_group_tweens_node = {
+    .definition_path = __FILE__,
+    .name = "tm_destroy_tween_group_tweens",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "group", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING },
+    },
+    .static_connectors.num_in = 2,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_destroy_group_tweens_f,
+};
+//----------------------------------------------------
+enum {
+    TWEEN_GET_FLOAT__TWEEN,
+    TWEEN_GET_FLOAT__OUT_GET_FLOAT,
+};
+
+static void tween_get_float_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_GET_FLOAT__TWEEN]);
+
+    if (tween_w.n == 0)
+        return;
+
+    const tm_tween_t tween = *(tm_tween_t *)tween_w.data;
+
+    float *float_value = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_GET_FLOAT__OUT_GET_FLOAT], 1, sizeof(*float_value));
+    *float_value = 0;
+
+    tm_tween_api->get_float(tween, float_value);
+}
+
+TWEEN_NODE_RUN(tween_get_float_f)
+
+static tm_graph_component_node_type_i tween_get_float_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_get_float",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_in = 1,
+    .static_connectors.out = {
+        { "value", TM_TT_TYPE_HASH__FLOAT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_get_float_f,
+};
+//----------------------------------------------------
+enum {
+    TWEEN_CREATE_TIMELINE__IN_WIRE,
+    TWEEN_CREATE_TIMELINE__TIMELINE,
+    TWEEN_CREATE_TIMELINE__OUT_WIRE,
+    TWEEN_CREATE_TIMELINE__OUT_TWEEN,
+};
+
+static void tween_create_timeline_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t timeline_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_TIMELINE__TIMELINE]);
+
+    tm_tween_t *v = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_TIMELINE__OUT_TWEEN], 1, sizeof(tm_tween_t));
+    *v = tm_tween_api->create_timeline(tm_tween_api->compile_timeline(timeline_w.data, timeline_w.n));
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE_TIMELINE__OUT_WIRE]);
+}
+
+TWEEN_NODE_RUN(tween_create_timeline_f)
+
+static tm_graph_component_node_type_i tween_create_timeline_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_create_timeline",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "timeline", TM_TT_TYPE_HASH__TWEEN_TIMELINE },
+    },
+    .static_connectors.num_in = 2,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_out = 2,
+    .run = run_tween_create_timeline_f,
+};
+//----------------------------------------------------
+// Vector tween nodes share the wire layout of `tm_tween_create` and `tm_tween_get_float`, except
+// for the extra `slerp` input of the quaternion node.
+enum {
+    CREATE_QUATERNION_TWEEN__IN_WIRE,
+    CREATE_QUATERNION_TWEEN__FROM,
+    CREATE_QUATERNION_TWEEN__TO,
+    CREATE_QUATERNION_TWEEN__DURATION,
+    CREATE_QUATERNION_TWEEN__EASING,
+    CREATE_QUATERNION_TWEEN__SLERP,
+    CREATE_QUATERNION_TWEEN__OUT_WIRE,
+    CREATE_QUATERNION_TWEEN__OUT_TWEEN,
+};
+
+static const tm_graph_generic_value_t tween_slerp_default_value = { .boolean = (bool[1]){ true } };
+
+static void tween_create_vector(tm_graph_interpreter_context_t *ctx, uint32_t type, uint32_t num_components, uint32_t out_wire)
+{
+    const tm_graph_interpreter_wire_content_t from_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__FROM]);
+    const tm_graph_interpreter_wire_content_t to_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__TO]);
+    const tm_graph_interpreter_wire_content_t duration_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__DURATION]);
+    const tm_graph_interpreter_wire_content_t easing_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__EASING]);
+
+    tm_vec4_t from = { 0 }, to = { 0 };
+    if (from_w.n > 0)
+        memcpy(&from, from_w.data, num_components * sizeof(float));
+    if (to_w.n > 0)
+        memcpy(&to, to_w.data, num_components * sizeof(float));
+    const float duration = duration_w.n > 0 ? *(float *)duration_w.data : *tween_duration_default_value.f;
+    const uint32_t easing = easing_w.n > 0 ? *(uint32_t *)easing_w.data : TM_TWEEN_EASING_ITEM_LINEAR;
+
+    tm_tween_t *v = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[out_wire + 1], 1, sizeof(tm_tween_t));
+    *v = tm_tween_api->create_vector(type, from, to, duration, easing);
+
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[out_wire]);
+}
+
+static void tween_get_vector(tm_graph_interpreter_context_t *ctx, uint32_t num_components)
+{
+    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_GET_FLOAT__TWEEN]);
+
+    if (tween_w.n == 0)
+        return;
+
+    const tm_tween_t tween = *(tm_tween_t *)tween_w.data;
+
+    tm_vec4_t value = { 0 };
+    tm_tween_api->get_vector(tween, &value);
+
+    float *out = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_GET_FLOAT__OUT_GET_FLOAT], 1, num_components * sizeof(float));
+    memcpy(out, &value, num_components * sizeof(float));
+}
+
+static void tween_create_vec2_f(tm_graph_interpreter_context_t *ctx)
+{
+    tween_create_vector(ctx, TM_TWEEN_VALUE_TYPE_VEC2, 2, TWEEN_CREATE__OUT_WIRE);
+}
+
+static void tween_create_vec3_f(tm_graph_interpreter_context_t *ctx)
+{
+    tween_create_vector(ctx, TM_TWEEN_VALUE_TYPE_VEC3, 3, TWEEN_CREATE__OUT_WIRE);
+}
+
+static void tween_create_vec4_f(tm_graph_interpreter_context_t *ctx)
+{
+    tween_create_vector(ctx, TM_TWEEN_VALUE_TYPE_VEC4, 4, TWEEN_CREATE__OUT_WIRE);
+}
+
+static void tween_create_quaternion_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t slerp_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[CREATE_QUATERNION_TWEEN__SLERP]);
+    const bool slerp = slerp_w.n > 0 ? *(bool *)slerp_w.data : *tween_slerp_default_value.boolean;
+    const uint32_t type = slerp ? TM_TWEEN_VALUE_TYPE_QUATERNION_SLERP : TM_TWEEN_VALUE_TYPE_QUATERNION_NLERP;
+    tween_create_vector(ctx, type, 4, CREATE_QUATERNION_TWEEN__OUT_WIRE);
+}
+
+static void tween_create_color_f(tm_graph_interpreter_context_t *ctx)
+{
+    tween_create_vector(ctx, TM_TWEEN_VALUE_TYPE_COLOR, 4, TWEEN_CREATE__OUT_WIRE);
+}
+
+static void tween_get_vec2_f(tm_graph_interpreter_context_t *ctx)
+{
+    tween_get_vector(ctx, 2);
+}
+
+static void tween_get_vec3_f(tm_graph_interpreter_context_t *ctx)
+{
+    tween_get_vector(ctx, 3);
+}
+
+static void tween_get_vec4_f(tm_graph_interpreter_context_t *ctx)
+{
+    tween_get_vector(ctx, 4);
+}
+
+TWEEN_NODE_RUN(tween_create_vec2_f)
+
+static tm_graph_component_node_type_i tween_create_vec2_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_create_vec2",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "from", TM_TT_TYPE_HASH__VEC2 },
+        { "to", TM_TT_TYPE_HASH__VEC2 },
+        { "duration", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_duration_default_value },
+        { "easing", TM_TT_TYPE_HASH__UINT32_T, TM_TT_TYPE_HASH__EASING_ITEM },
+    },
+    .static_connectors.num_in = 5,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_VEC2_ITEM },
+    },
+    .static_connectors.num_out = 2,
+    .run = run_tween_create_vec2_f,
+};
+
+TWEEN_NODE_RUN(tween_create_vec3_f)
+
+static tm_graph_component_node_type_i tween_create_vec3_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_create_vec3",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "from", TM_TT_TYPE_HASH__VEC3 },
+        { "to", TM_TT_TYPE_HASH__VEC3 },
+        { "duration", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_duration_default_value },
+        { "easing", TM_TT_TYPE_HASH__UINT32_T, TM_TT_TYPE_HASH__EASING_ITEM },
+    },
+    .static_connectors.num_in = 5,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_VEC3_ITEM },
+    },
+    .static_connectors.num_out = 2,
+    .run = run_tween_create_vec3_f,
+};
+
+TWEEN_NODE_RUN(tween_create_vec4_f)
+
+static tm_graph_component_node_type_i tween_create_vec4_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_create_vec4",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "from", TM_TT_TYPE_HASH__VEC4 },
+        { "to", TM_TT_TYPE_HASH__VEC4 },
+        { "duration", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_duration_default_value },
+        { "easing", TM_TT_TYPE_HASH__UINT32_T, TM_TT_TYPE_HASH__EASING_ITEM },
+    },
+    .static_connectors.num_in = 5,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_VEC4_ITEM },
+    },
+    .static_connectors.num_out = 2,
+    .run = run_tween_create_vec4_f,
+};
+
+TWEEN_NODE_RUN(tween_create_quaternion_f)
+
+static tm_graph_component_node_type_i tween_create_quaternion_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_create_quaternion",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "from", TM_TT_TYPE_HASH__VEC4, TM_TT_TYPE_HASH__ROTATION },
+        { "to", TM_TT_TYPE_HASH__VEC4, TM_TT_TYPE_HASH__ROTATION },
+        { "duration", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_duration_default_value },
+        { "easing", TM_TT_TYPE_HASH__UINT32_T, TM_TT_TYPE_HASH__EASING_ITEM },
+        { "slerp", TM_TT_TYPE_HASH__BOOL, .optional = true, .default_value = &tween_slerp_default_value },
+    },
+    .static_connectors.num_in = 6,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_QUATERNION_ITEM },
+    },
+    .static_connectors.num_out = 2,
+    .run = run_tween_create_quaternion_f,
+};
+
+TWEEN_NODE_RUN(tween_create_color_f)
+
+static tm_graph_component_node_type_i tween_create_color_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_create_color",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "from", TM_TT_TYPE_HASH__VEC4, TM_TT_TYPE_HASH__COLOR_RGBA },
+        { "to", TM_TT_TYPE_HASH__VEC4, TM_TT_TYPE_HASH__COLOR_RGBA },
+        { "duration", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_duration_default_value },
+        { "easing", TM_TT_TYPE_HASH__UINT32_T, TM_TT_TYPE_HASH__EASING_ITEM },
+    },
+    .static_connectors.num_in = 5,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "tween", TM_TT_TYPE_HASH__TWEEN_COLOR_ITEM },
+    },
+    .static_connectors.num_out = 2,
+    .run = run_tween_create_color_f,
+};
+
+TWEEN_NODE_RUN(tween_get_vec2_f)
+
+static tm_graph_component_node_type_i tween_get_vec2_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_get_vec2",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "tween", TM_TT_TYPE_HASH__TWEEN_VEC2_ITEM },
+    },
+    .static_connectors.num_in = 1,
+    .static_connectors.out = {
+        { "value", TM_TT_TYPE_HASH__VEC2 },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_get_vec2_f,
+};
+
+TWEEN_NODE_RUN(tween_get_vec3_f)
+
+static tm_graph_component_node_type_i tween_get_vec3_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_get_vec3",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "tween", TM_TT_TYPE_HASH__TWEEN_VEC3_ITEM },
+    },
+    .static_connectors.num_in = 1,
+    .static_connectors.out = {
+        { "value", TM_TT_TYPE_HASH__VEC3 },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_get_vec3_f,
+};
+
+TWEEN_NODE_RUN(tween_get_vec4_f)
+
+static tm_graph_component_node_type_i tween_get_vec4_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_get_vec4",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "tween", TM_TT_TYPE_HASH__TWEEN_VEC4_ITEM },
+    },
+    .static_connectors.num_in = 1,
+    .static_connectors.out = {
+        { "value", TM_TT_TYPE_HASH__VEC4 },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_get_vec4_f,
+};
+
+static tm_graph_component_node_type_i tween_get_quaternion_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_get_quaternion",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "tween", TM_TT_TYPE_HASH__TWEEN_QUATERNION_ITEM },
+    },
+    .static_connectors.num_in = 1,
+    .static_connectors.out = {
+        { "value", TM_TT_TYPE_HASH__VEC4, TM_TT_TYPE_HASH__ROTATION },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_get_vec4_f,
+};
+
+static tm_graph_component_node_type_i tween_get_color_node = {
+    .definition_path = __FILE__,
+    .name = "tm_tween_get_color",
+    .category = TM_LOCALIZE_LATER("Tween"),
+    .static_connectors.in = {
+        { "tween", TM_TT_TYPE_HASH__TWEEN_COLOR_ITEM },
+    },
+    .static_connectors.num_in = 1,
+    .static_connectors.out = {
+        { "value", TM_TT_TYPE_HASH__VEC4, TM_TT_TYPE_HASH__COLOR_RGBA },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_tween_get_vec4_f,
+};
+//----------------------------------------------------
+enum {
+    GET_TWEEN_VARIABLE__NAME,
+    GET_TWEEN_VARIABLE__OUT_VALUE,
+};
+
+static void get_tween_variable_node_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t name_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[GET_TWEEN_VARIABLE__NAME]);
+
+    if (name_w.n == 0)
+        return;
+
+    const tm_string_hash_t name = *(tm_string_hash_t *)name_w.data;
+
+    tm_tween_t *value = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[GET_TWEEN_VARIABLE__OUT_VALUE], 1, sizeof(*value));
+
+    get_tween_variable(ctx, name, value);
+}
+
+TWEEN_NODE_RUN(get_tween_variable_node_f)
+
+static tm_graph_component_node_type_i get_tween_variable_node = {
+    .definition_path = __FILE__,
+    .name = "tm_get_tween_variable",
+    .category = TM_LOCALIZE_LATER("Graph Variables"),
+    .static_connectors.in = {
+        { "name", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING },
+    },
+    .static_connectors.num_in = 1,
+    .static_connectors.out = {
+        { "value", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_get_tween_variable_node_f,
+};
+//----------------------------------------------------
+enum {
+    SET_TWEEN_VARIABLE__IN_EVENT,
+    SET_TWEEN_VARIABLE__NAME,
+    SET_TWEEN_VARIABLE__VALUE,
+    SET_TWEEN_VARIABLE__OUT_EVENT,
+};
+
+static void set_tween_variable_node_f(tm_graph_interpreter_context_t *ctx)
+{
+    const tm_graph_interpreter_wire_content_t name_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[SET_TWEEN_VARIABLE__NAME]);
+    const tm_graph_interpreter_wire_content_t value_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[SET_TWEEN_VARIABLE__VALUE]);
+
+    if (name_w.n == 0)
+        return;
 
-    uint32_t id;
+    const tm_string_hash_t name = *(tm_string_hash_t *)name_w.data;
+    const tm_tween_t value = *(tm_tween_t *)value_w.data;
 
-    bool paused;
-};
+    set_tween_variable(ctx, name, value);
 
-static uint32_t next_id = 1; // id = 0 means error/no tween
+    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[SET_TWEEN_VARIABLE__OUT_EVENT]);
+}
 
-struct tm_tween_manager_o
-{
-    tm_entity_context_o *ctx;
-    tm_tween_item_o *tweens;
+TWEEN_NODE_RUN(set_tween_variable_node_f)
+
+static tm_graph_component_node_type_i set_tween_variable_node = {
+    .definition_path = __FILE__,
+    .name = "tm_set_tween_variable",
+    .category = TM_LOCALIZE_LATER("Graph Variables"),
+    .static_connectors.in = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+        { "name", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING },
+        { "value", TM_TT_TYPE_HASH__TWEEN_ITEM },
+    },
+    .static_connectors.num_in = 3,
+    .static_connectors.out = {
+        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
+    },
+    .static_connectors.num_out = 1,
+    .run = run_set_tween_variable_node_f,
 };
+//----------------------------------------------------
 
-static tm_tween_item_o * find_tween_item(uint32_t id)
+static void load_nodes(struct tm_api_registry_api* reg, bool load)
 {
-    tm_tween_manager_o * manager = tm_tween_api->manager;
-    uint32_t n_tweens = (uint32_t)tm_carray_size(manager->tweens);
-
-    for (uint32_t i = 0; i < n_tweens; ++i)
+    tm_graph_component_node_type_i* nodes[] = {
+        &tween_create_node,
+        &tween_get_float_node,
+        &tween_create_timeline_node,
+        &tween_create_vec2_node,
+        &tween_create_vec3_node,
+        &tween_create_vec4_node,
+        &tween_create_quaternion_node,
+        &tween_create_color_node,
+        &tween_get_vec2_node,
+        &tween_get_vec3_node,
+        &tween_get_vec4_node,
+        &tween_get_quaternion_node,
+        &tween_get_color_node,
+        &tween_is_running_node,
+        &on_tween_finished_node,
+        &tween_is_paused_node,
+        &pause_tween_node,
+        &tween_then_node,
+        &tween_set_repeat_node,
+        &create_tween_group_node,
+        &set_tween_group_node,
+        &pause_tween_group_node,
+        &set_tween_group_time_scale_node,
+        &destroy_tween_group_tweens_node,
+        &tween_destroy_node,
+        &tween_create_many_node,
+        &tween_destroy_many_node,
+        &tween_get_float_many_node,
+        &get_tween_variable_node,
+        &set_tween_variable_node,
+    };
+    for (int i = 0; i != TM_ARRAY_COUNT(nodes); ++i)
     {
-        tm_tween_item_o * item = &manager->tweens[i];
-        if (item->id == id)
-        {
-            return item;
-        }
+        tm_add_or_remove_implementation(reg, load, tm_graph_component_node_type_i, nodes[i]);
     }
-
-    return NULL;
 }
 
-static void tween_init(struct tm_entity_context_o *ctx, tm_entity_system_o *inst, struct tm_entity_commands_o *commands)
+static tm_tween_t create(float from, float to, float duration, uint32_t easing)
 {
+    tm_tween_manager_o *manager = current_manager();
+    return manager ? create_tween(manager, (tm_tween_t){ 0 }, from, to, duration, easing) : (tm_tween_t){ 0 };
+}
 
+static void destroy(tm_tween_t tween)
+{
+    tm_tween_manager_o *manager = current_manager();
+    uint32_t i;
+    if (counted_lookup(manager, TWEEN_COUNTERS__API, tween, &i))
+        destroy_tween(manager, tween, i);
 }
 
-static void tween_update(struct tm_entity_context_o *ctx, tm_entity_system_o *inst, struct tm_entity_commands_o *commands)
+static bool create_many(const float *from, const float *to, const float *duration, const uint32_t *easing, uint32_t num_tweens, tm_strhash_t group, tm_tween_t *tweens)
 {
-    const double dt = tm_entity_api->get_blackboard_double(ctx, TM_ENTITY_BB__DELTA_TIME, 1.0 / 60.0);
-    const double editor = tm_entity_api->get_blackboard_double(ctx, TM_ENTITY_BB__EDITOR, 0.0);
-    if (editor) return;
+    tm_tween_manager_o *manager = current_manager();
+    const uint32_t g = find_group(manager, group);
+    if (g == TWEEN_NO_SLOT)
+        return false;
 
-    tm_tween_manager_o *manager = (tm_tween_manager_o *)inst;
-    uint32_t n_tweens = (uint32_t)tm_carray_size(manager->tweens);
-    uint32_t n_finished_tweens = 0;
-    for (uint32_t i = 0; i < n_tweens; ++i)
-    {
-        tm_tween_item_o * item = &manager->tweens[i];
+    create_tweens(manager, from, to, duration, easing, num_tweens, g, tweens);
+    return true;
+}
 
-        if (item->elapsed >= item->duration)
-        {
-            n_finished_tweens++;
-        }
-    }
+static uint32_t destroy_many(const tm_tween_t *tweens, uint32_t num_tweens)
+{
+    tm_tween_manager_o *manager = current_manager();
+    uint32_t num_destroyed = 0;
+    uint32_t i;
+    if (!manager)
+        return 0;
 
-    if (n_finished_tweens)
+    // Removing one tween moves at most one tween per bucket, a compaction every tween after the
+    // first one removed.
+    if ((uint64_t)num_tweens * TWEEN_NUM_BUCKETS < manager->num_tweens)
     {
-        uint32_t last_position = n_tweens - 1;
-
-        uint32_t i = 0;
-        while (i < last_position)
+        for (uint32_t k = 0; k < num_tweens; ++k)
         {
-            tm_tween_item_o item = manager->tweens[i];
-
-            if (item.elapsed >= item.duration)
-            {
-                manager->tweens[i] = manager->tweens[last_position];
-                manager->tweens[last_position] = item;
-                --last_position;
-            }
-            else
+            if (counted_lookup(manager, TWEEN_COUNTERS__API, tweens[k], &i))
             {
-                ++i;
+                destroy_tween(manager, tweens[k], i);
+                ++num_destroyed;
             }
         }
-
-        tm_carray_shrink(manager->tweens, i);
+        return num_destroyed;
     }
 
-    for (uint32_t i = 0; i < n_tweens; ++i)
+    uint32_t first = manager->num_tweens;
+    for (uint32_t k = 0; k < num_tweens; ++k)
     {
-        tm_tween_item_o * item = &manager->tweens[i];
-
-        if (!item->paused)
+        if (counted_lookup(manager, TWEEN_COUNTERS__API, tweens[k], &i))
         {
-            item->elapsed += dt;
+            clear_tween(manager, tweens[k], i);
+            first = i < first ? i : first;
+            ++num_destroyed;
         }
     }
 
+    if (num_destroyed)
+        remove_cleared(manager, first);
+    return num_destroyed;
+}
+
+static tm_tween_t enqueue_create(float from, float to, float duration, uint32_t easing)
+{
+    tm_tween_manager_o *manager = current_manager();
+    uint64_t position;
+    tween_command_t *c = claim_command(manager, &position);
+    if (!c)
+        return (tm_tween_t){ 0 };
 
+    c->type = TWEEN_COMMAND__CREATE;
+    c->tween = reserve_handle(manager);
+    c->from = from;
+    c->to = to;
+    c->duration = duration;
+    c->easing = (uint16_t)valid_easing(easing);
+    const tm_tween_t tween = c->tween;
+    publish_command(c, position);
+    return tween;
 }
 
-static void tween_shutdown(struct tm_entity_context_o *ctx, tm_entity_system_o *inst, struct tm_entity_commands_o *commands)
+static bool enqueue_destroy(tm_tween_t tween)
 {
+    tm_tween_manager_o *manager = current_manager();
+    uint64_t position;
+    tween_command_t *c = claim_command(manager, &position);
+    if (!c)
+        return false;
 
+    c->type = TWEEN_COMMAND__DESTROY;
+    c->tween = tween;
+    publish_command(c, position);
+    return true;
 }
 
-static void register_tween_system(struct tm_entity_context_o *ctx)
+static bool enqueue_pause(tm_tween_t tween, bool paused)
 {
-    tm_allocator_i a;
-    tm_entity_api->create_child_allocator(ctx, TM_TT_TYPE__GRAPH_COMPONENT, &a);
+    tm_tween_manager_o *manager = current_manager();
+    uint64_t position;
+    tween_command_t *c = claim_command(manager, &position);
+    if (!c)
+        return false;
 
-    tm_tween_manager_o * manager = tm_alloc(&a, sizeof(*manager));
-    *(manager) = (tm_tween_manager_o){
-        .ctx = ctx,
-        .tweens = NULL,
-    };
+    c->type = TWEEN_COMMAND__PAUSE;
+    c->tween = tween;
+    c->paused = paused;
+    publish_command(c, position);
+    return true;
+}
 
-    const tm_entity_system_i tween_system = {
-        .ui_name = TM_TWEEN_SYSTEM,
-        .hash = TM_TWEEN_SYSTEM_HASH,
-        .init = tween_init,
-        .update = tween_update,
-        .shutdown = tween_shutdown,
-        .inst = (tm_entity_system_o *)manager,
-    };
-    tm_entity_api->register_system(ctx, &tween_system);
+static bool pause_tween(tm_tween_t tween, bool paused)
+{
+    tm_tween_manager_o *manager = current_manager();
+    uint32_t i;
+    if (!counted_lookup(manager, TWEEN_COUNTERS__API, tween, &i))
+        return false;
+
+    set_paused(manager, i, paused);
+    return true;
 }
 
-static inline void get_tween_variable(tm_graph_interpreter_context_t *ctx, tm_string_hash_t name, uint32_t *value)
+static bool set_repeat(tm_tween_t tween, uint32_t repeats, uint32_t mode)
 {
-    tm_graph_interpreter_wire_content_t var_w = tm_graph_interpreter_api->read_variable(ctx->interpreter, name);
-    if (var_w.n)
-        *value = *(uint32_t *)var_w.data;
+    tm_tween_manager_o *manager = current_manager();
+    uint32_t i;
+    if (!counted_lookup(manager, TWEEN_COUNTERS__API, tween, &i))
+        return false;
+
+    tween_slot_t *slot = manager->slots + tween.index;
+    if (!(slot->duration > 0.0f))
+        return false;
+
+    manager->num_repeating += (repeats != 0) - (slot->repeats != 0);
+    slot->repeats = repeats;
+    slot->repeat_mode = mode == TM_TWEEN_REPEAT_YOYO ? TM_TWEEN_REPEAT_YOYO : TM_TWEEN_REPEAT_RESTART;
+    return true;
 }
 
-static inline void set_tween_variable(tm_graph_interpreter_context_t *ctx, tm_string_hash_t name, uint32_t value)
+static void ease(uint32_t easing, const float *t, float *res, uint32_t n)
 {
-    uint32_t *var = tm_graph_interpreter_api->write_variable(ctx->interpreter, name, 1, sizeof(*var));
-    *var = value;
+    easing = valid_easing(easing);
+    if (easing < TM_TWEEN_EASING_ITEM_COUNT)
+    {
+        easingBatchFunctions[easing](t, res, n);
+        return;
+    }
+
+    const tween_curve_t *curve = custom_curve(easing);
+    for (uint32_t j = 0; j < n; ++j)
+        res[j] = sample_curve(curve, t[j]);
 }
 
-// NODES
-//----------------------------------------------------
-enum {
-    TWEEN_CREATE__IN_WIRE,
-    TWEEN_CREATE__FROM,
-    TWEEN_CREATE__TO,
-    TWEEN_CREATE__DURATION,
-    TWEEN_CREATE__EASING,
-    TWEEN_CREATE__OUT_WIRE,
-    TWEEN_CREATE__OUT_TWEEN,
-};
+static uint32_t evaluate_all(float *values, tm_tween_t *tweens, uint32_t capacity)
+{
+    const tm_tween_manager_o *manager = current_manager();
+    if (!manager || !manager->num_tweens || capacity < manager->num_tweens)
+        return manager ? manager->num_tweens : 0;
 
-static const tm_graph_generic_value_t tween_from_default_value = { .f = (float[1]){ 0 } };
-static const tm_graph_generic_value_t tween_to_default_value = { .f = (float[1]){ 1 } };
-static const tm_graph_generic_value_t tween_duration_default_value = { .f = (float[1]){ 1 } };
+    if (manager->cache_values)
+        memcpy(values, manager->values, manager->num_tweens * sizeof(*values));
+    else
+        evaluate_all_buckets(manager, values);
 
-static void tween_create_f(tm_graph_interpreter_context_t *ctx)
+    if (tweens)
+        memcpy(tweens, manager->handle, manager->num_tweens * sizeof(*tweens));
+
+    return manager->num_tweens;
+}
+
+static void set_value_cache(bool enabled)
 {
-    const tm_graph_interpreter_wire_content_t from_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__FROM]);
-    const tm_graph_interpreter_wire_content_t to_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__TO]);
-    const tm_graph_interpreter_wire_content_t duration_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__DURATION]);
-    const tm_graph_interpreter_wire_content_t easing_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__EASING]);
+    tm_tween_manager_o *manager = current_manager();
+    if (!manager || manager->cache_values == enabled)
+        return;
 
-    const float from = from_w.n > 0 ? *(float *)from_w.data : *tween_from_default_value.f;
-    const float to = to_w.n > 0 ? *(float *)to_w.data : *tween_to_default_value.f;
-    const float duration = duration_w.n > 0 ? *(float *)duration_w.data : *tween_duration_default_value.f;
-    const uint32_t easing = easing_w.n > 0 ? *(uint32_t *)easing_w.data : TM_TWEEN_EASING_ITEM_LINEAR;
+    manager->cache_values = enabled;
+    if (enabled)
+        evaluate_all_buckets(manager, manager->values);
+}
 
-    tm_tween_item_o *tween = tm_tween_api->create(from, to, duration, easingFunctions[easing]);
-    uint32_t *v = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__OUT_TWEEN], 1, sizeof(uint32_t));
-    *v = tween->id;
+static uint32_t cached_values(const float **values, const tm_tween_t **tweens)
+{
+    const tm_tween_manager_o *manager = current_manager();
+    if (!manager || !manager->cache_values)
+        return 0;
 
-    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[TWEEN_CREATE__OUT_WIRE]);
+    *values = manager->values;
+    if (tweens)
+        *tweens = manager->handle;
+    return manager->num_tweens;
 }
 
-static tm_graph_component_node_type_i tween_create_node = {
-    .definition_path = __FILE__,
-    .name = "tm_tween_create",
-    .category = TM_LOCALIZE_LATER("Tween"),
-    .static_connectors.in = {
-        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
-        { "from", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_from_default_value },
-        { "to", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_to_default_value },
-        { "duration", TM_TT_TYPE_HASH__FLOAT, .optional = true, .default_value = &tween_duration_default_value },
-        { "easing", TM_TT_TYPE_HASH__UINT32_T, TM_TT_TYPE_HASH__EASING_ITEM },
-    },
-    .static_connectors.num_in = 5,
-    .static_connectors.out = {
-        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
-        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
-    },
-    .static_connectors.num_out = 2,
-    .run = tween_create_f,
-};
+static tm_tween_t create_vector(uint32_t type, tm_vec4_t from, tm_vec4_t to, float duration, uint32_t easing)
+{
+    if (type == TM_TWEEN_VALUE_TYPE_FLOAT || type >= TM_TWEEN_VALUE_TYPE_COUNT)
+        return create(from.x, to.x, duration, easing);
 
-//----------------------------------------------------
-enum {
-    TWEEN_DESTROY__IN_WIRE,
-    TWEEN_DESTROY__TWEEN,
-    TWEEN_DESTROY__OUT_WIRE,
-};
+    tm_tween_manager_o *manager = current_manager();
+    const tm_tween_t tween = create(0.0f, 1.0f, duration, easing);
+    if (!tween.u64)
+        return tween;
 
-static void tween_destroy_f(tm_graph_interpreter_context_t *ctx)
+    tween_vector_t v = {
+        .from = { from.x, from.y, from.z, from.w },
+        .to = { to.x, to.y, to.z, to.w },
+        .type = type,
+    };
+
+    const uint32_t num_components = type == TM_TWEEN_VALUE_TYPE_VEC2 ? 2 : type == TM_TWEEN_VALUE_TYPE_VEC3 ? 3 : 4;
+    for (uint32_t c = num_components; c < 4; ++c)
+        v.from[c] = v.to[c] = 0.0f;
+
+    if (type == TM_TWEEN_VALUE_TYPE_QUATERNION_NLERP || type == TM_TWEEN_VALUE_TYPE_QUATERNION_SLERP)
+    {
+        normalize_quaternion(v.from);
+        normalize_quaternion(v.to);
+        if (v.from[0] * v.to[0] + v.from[1] * v.to[1] + v.from[2] * v.to[2] + v.from[3] * v.to[3] < 0.0f)
+        {
+            for (uint32_t c = 0; c < 4; ++c)
+                v.to[c] = -v.to[c];
+        }
+    }
+    else if (type == TM_TWEEN_VALUE_TYPE_COLOR)
+    {
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            v.from[c] = srgb_to_linear(v.from[c]);
+            v.to[c] = srgb_to_linear(v.to[c]);
+        }
+    }
+
+    uint32_t index = manager->first_free_vector;
+    if (index != TWEEN_NO_SLOT)
+    {
+        manager->first_free_vector = manager->vectors[index].next_free;
+        manager->vectors[index] = v;
+    }
+    else
+    {
+        index = (uint32_t)tm_carray_size(manager->vectors);
+        tm_carray_push(manager->vectors, v, &manager->counting_allocator);
+    }
+    manager->slots[tween.index].vector = index;
+
+    return tween;
+}
+
+static bool get_vector(tm_tween_t tween, tm_vec4_t *value)
 {
-    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_DESTROY__TWEEN]);
+    float res[4] = { 0 };
+    if (!read_value(current_manager(), TWEEN_COUNTERS__API, tween, res))
+        return false;
 
-    if (tween_w.n == 0)
-        return;
+    *value = (tm_vec4_t){ res[0], res[1], res[2], res[3] };
+    return true;
+}
+
+static void set_snapshot(bool enabled)
+{
+    tm_tween_manager_o *manager = current_manager();
+    if (manager)
+        manager->snapshot_enabled = enabled;
+}
 
-    uint32_t tween_id = *(uint32_t *)tween_w.data;
+static uint32_t read_snapshot(const tm_tween_t *tweens, uint32_t num_tweens, tm_vec4_t *values)
+{
+    tm_tween_manager_o *manager = current_manager();
+    if (!manager)
+        return 0;
 
-    tm_tween_item_o * item = find_tween_item(tween_id);
-    if (item)
-        tm_tween_api->destroy(item);
+    const uint64_t state = atomic_fetch_add_uint64_t(&manager->snapshot_state, 1);
+    tween_snapshot_t *snapshot = manager->snapshots + (state >> 32);
+    const uint32_t num_entries = (uint32_t)tm_carray_size(snapshot->entries);
 
-    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[TWEEN_DESTROY__OUT_WIRE]);
+    uint32_t num_alive = 0;
+    for (uint32_t t = 0; t < num_tweens; ++t)
+    {
+        const tween_snapshot_entry_t *e = tweens[t].index < num_entries ? snapshot->entries + tweens[t].index : NULL;
+        if (e && tweens[t].generation && e->generation == tweens[t].generation)
+        {
+            memcpy(values + t, e->value, sizeof(*values));
+            ++num_alive;
+        }
+        else
+            values[t] = (tm_vec4_t){ 0 };
+    }
+
+    atomic_fetch_add_uint32_t(&snapshot->egress, 1);
+    return num_alive;
 }
 
-static tm_graph_component_node_type_i tween_destroy_node = {
-    .definition_path = __FILE__,
-    .name = "tm_tween_destroy",
-    .category = TM_LOCALIZE_LATER("Tween"),
-    .static_connectors.in = {
-        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
-        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
-    },
-    .static_connectors.num_in = 2,
-    .static_connectors.out = {
-        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
-    },
-    .static_connectors.num_out = 1,
-    .run = tween_destroy_f,
-};
-//----------------------------------------------------
-enum {
-    TWEEN_IS_RUNNING__TWEEN,
-    TWEEN_IS_RUNNING__OUT_IS_RUNNING,
-};
+static bool get_float(tm_tween_t tween, float *value)
+{
+    tm_tween_manager_o *manager = current_manager();
+    uint32_t i;
+    if (!counted_lookup(manager, TWEEN_COUNTERS__API, tween, &i))
+        return false;
 
-static void tween_is_running_f(tm_graph_interpreter_context_t *ctx)
+    *value = tween_value(manager, tween.index, i);
+    return true;
+}
+
+static uint32_t get_float_many(const tm_tween_t *tweens, uint32_t num_tweens, float *values)
 {
-    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_IS_RUNNING__TWEEN]);
+    tm_tween_manager_o *manager = current_manager();
+    uint32_t num_alive = 0;
+    for (uint32_t k = 0; k < num_tweens; ++k)
+    {
+        uint32_t i;
+        const bool alive = counted_lookup(manager, TWEEN_COUNTERS__API, tweens[k], &i);
+        values[k] = alive ? tween_value(manager, tweens[k].index, i) : 0.0f;
+        num_alive += alive;
+    }
+    return num_alive;
+}
 
-    if (tween_w.n == 0)
-        return;
+static uint32_t finished(const tm_tween_t **tweens)
+{
+    const tm_tween_manager_o *manager = current_manager();
+    *tweens = manager ? manager->job.finished_handles : 0;
+    return manager ? (uint32_t)tm_carray_size(manager->job.finished_handles) : 0;
+}
 
-    uint32_t tween_id = *(uint32_t *)tween_w.data;
-    bool *is_running = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_IS_RUNNING__OUT_IS_RUNNING], 1, sizeof(*is_running));
+static tm_tween_timeline_t compile_timeline(const tm_tween_keyframe_t *keys, uint32_t num_keys)
+{
+    tm_tween_manager_o *manager = current_manager();
+    if (!manager || !num_keys)
+        return (tm_tween_timeline_t){ 0 };
+
+    const uint32_t first_key = (uint32_t)tm_carray_size(manager->keyframes);
+    tm_carray_push_array(manager->keyframes, keys, num_keys, &manager->counting_allocator);
+    tm_tween_keyframe_t *compiled = manager->keyframes + first_key;
+
+    // Insertion sort, keyframes sharing a time keep their order.
+    for (uint32_t k = 1; k < num_keys; ++k)
+    {
+        const tm_tween_keyframe_t key = compiled[k];
+        uint32_t j = k;
+        for (; j > 0 && compiled[j - 1].time > key.time; --j)
+            compiled[j] = compiled[j - 1];
+        compiled[j] = key;
+    }
+    for (uint32_t k = 0; k < num_keys; ++k)
+    {
+        compiled[k].easing = valid_easing(compiled[k].easing);
+    }
+
+    const uint64_t hash = hash_bytes(compiled, num_keys * sizeof(*compiled));
+    const uint32_t num_timelines = (uint32_t)tm_carray_size(manager->timelines);
+    for (uint32_t t = 0; t < num_timelines; ++t)
+    {
+        const tween_timeline_t *timeline = manager->timelines + t;
+        if (timeline->hash == hash && timeline->num_keys == num_keys && !memcmp(manager->keyframes + timeline->first_key, compiled, num_keys * sizeof(*compiled)))
+        {
+            tm_carray_shrink(manager->keyframes, first_key);
+            return (tm_tween_timeline_t){ t + 1 };
+        }
+    }
 
-    tm_tween_item_o * item = find_tween_item(tween_id);
-    *is_running = item != NULL;
+    const tween_timeline_t timeline = { .hash = hash, .first_key = first_key, .num_keys = num_keys };
+    tm_carray_push(manager->timelines, timeline, &manager->counting_allocator);
+    return (tm_tween_timeline_t){ num_timelines + 1 };
 }
 
-static tm_graph_component_node_type_i tween_is_running_node = {
-    .definition_path = __FILE__,
-    .name = "tm_tween_is_running",
-    .category = TM_LOCALIZE_LATER("Tween"),
-    .static_connectors.in = {
-        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
-    },
-    .static_connectors.num_in = 1,
-    .static_connectors.out = {
-        { "is running", TM_TT_TYPE_HASH__BOOL },
-    },
-    .static_connectors.num_out = 1,
-    .run = tween_is_running_f,
-};
-//----------------------------------------------------
-enum {
-    TWEEN_IS_PAUSED__TWEEN,
-    TWEEN_IS_PAUSED__OUT_IS_PAUSED,
-};
+static tm_tween_t create_timeline(tm_tween_timeline_t timeline)
+{
+    tm_tween_manager_o *manager = current_manager();
+    if (!manager || !timeline.u32 || timeline.u32 > tm_carray_size(manager->timelines))
+        return (tm_tween_t){ 0 };
+
+    const tween_timeline_t *t = manager->timelines + timeline.u32 - 1;
+    const float length = fmaxf(manager->keyframes[t->first_key + t->num_keys - 1].time, 0.0f);
+    const tm_tween_t tween = create(0.0f, length, length, TM_TWEEN_EASING_ITEM_LINEAR);
+
+    const tween_playhead_t p = { .timeline = timeline.u32 - 1, .slot = tween.index };
+    uint32_t index = manager->first_free_playhead;
+    if (index != TWEEN_NO_SLOT)
+    {
+        manager->first_free_playhead = manager->playheads[index].next_free;
+        manager->playheads[index] = p;
+    }
+    else
+    {
+        index = (uint32_t)tm_carray_size(manager->playheads);
+        tm_carray_push(manager->playheads, p, &manager->counting_allocator);
+    }
+    manager->slots[tween.index].playhead = index;
+    ++manager->num_playheads;
 
-static void tween_is_paused_f(tm_graph_interpreter_context_t *ctx)
+    return tween;
+}
+
+// Bakes `points` into a new curve, or returns NULL if fewer than two points have distinct `x`.
+// Called before taking `curves_lock`, whose acquisition orders these writes before the publish.
+static tween_curve_t *new_curve(const tm_tween_curve_point_t *points, uint32_t num_points)
 {
-    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_IS_PAUSED__TWEEN]);
+    if (num_points < 2)
+        return NULL;
 
-    if (tween_w.n == 0)
-        return;
+    // Segments are baked into the same block, after the points.
+    const uint64_t bytes = sizeof(tween_curve_t) + num_points * sizeof(tm_tween_curve_point_t) + (num_points - 1) * sizeof(tween_curve_segment_t);
+    tm_allocator_i *a = tm_allocator_api->system;
+    tween_curve_t *curve = tm_alloc(a, bytes);
+    *curve = (tween_curve_t){
+        .bytes = bytes,
+        .points = (tm_tween_curve_point_t *)(curve + 1),
+        .num_points = num_points,
+    };
+    curve->segments = (tween_curve_segment_t *)(curve->points + num_points);
 
-    uint32_t tween_id = *(uint32_t *)tween_w.data;
-    bool *is_paused = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_IS_PAUSED__OUT_IS_PAUSED], 1, sizeof(*is_paused));
+    // Insertion sort, points sharing an `x` keep their order.
+    tm_tween_curve_point_t *sorted = curve->points;
+    for (uint32_t k = 0; k < num_points; ++k)
+    {
+        uint32_t j = k;
+        for (; j > 0 && sorted[j - 1].x > points[k].x; --j)
+            sorted[j] = sorted[j - 1];
+        sorted[j] = points[k];
+    }
 
-    tm_tween_item_o * item = find_tween_item(tween_id);
-    if (item)
+    // Points sharing an `x` make a jump, the later one starts the next segment.
+    for (uint32_t k = 0; k + 1 < num_points; ++k)
     {
-        *is_paused = item->paused;
+        if (sorted[k + 1].x > sorted[k].x)
+            bake_segment(curve->segments + curve->num_segments++, sorted + k, sorted + k + 1);
     }
-    else
+    if (!curve->num_segments)
     {
-        *is_paused = false;
+        tm_free(a, curve, bytes);
+        return NULL;
     }
+    curve->hash = hash_bytes(sorted, num_points * sizeof(*sorted));
+    return curve;
 }
 
-static tm_graph_component_node_type_i tween_is_paused_node = {
-    .definition_path = __FILE__,
-    .name = "tm_tween_is_paused",
-    .category = TM_LOCALIZE_LATER("Tween"),
-    .static_connectors.in = {
-        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
-    },
-    .static_connectors.num_in = 1,
-    .static_connectors.out = {
-        { "is paused", TM_TT_TYPE_HASH__BOOL },
-    },
-    .static_connectors.num_out = 1,
-    .run = tween_is_paused_f,
-};
-//----------------------------------------------------
-enum {
-    PAUSE_TWEEN__IN_EVENT,
-    PAUSE_TWEEN__TWEEN,
-    PAUSE_TWEEN__PAUSE,
-    PAUSE_TWEEN__OUT_EVENT,
-};
-
-static const tm_graph_generic_value_t tween_pause_default_value = { .boolean = (bool[1]){ false } };
+static bool same_curve(const tween_curve_t *a, const tween_curve_t *b)
+{
+    return a->hash == b->hash && a->num_points == b->num_points && !memcmp(a->points, b->points, a->num_points * sizeof(*a->points));
+}
 
-static void tween_pause_f(tm_graph_interpreter_context_t *ctx)
+// Publishes `curve` and returns its easing value. If `curve` has an owner, it replaces the curve
+// of the same owner, otherwise it is shared with an identical curve without one. Takes ownership
+// of `curve`.
+static uint32_t publish_curve(tween_curve_t *curve)
 {
-    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[PAUSE_TWEEN__TWEEN]);
-    const tm_graph_interpreter_wire_content_t pause_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[PAUSE_TWEEN__PAUSE]);
+    uint64_t unlocked = 0;
+    while (!atomic_compare_exchange_weak_uint64_t(&curves_lock, &unlocked, 1))
+        unlocked = 0;
 
-    if (tween_w.n == 0)
-        return;
+    const uint32_t n = atomic_load_uint32_t(&num_curves);
+    uint32_t index = n;
+    tween_curve_t *unused = NULL;
+    for (uint32_t c = 0; c < n; ++c)
+    {
+        const tween_curve_t *other = curves[c];
+        const bool same_owner = other->owner_tt == curve->owner_tt && other->owner.u64 == curve->owner.u64;
+        if (same_owner && (curve->owner.u64 || same_curve(other, curve)))
+        {
+            index = c;
+            break;
+        }
+    }
+    if (index == n && n < TM_TWEEN_MAX_CURVES)
+    {
+        curves[n] = curve;
+        atomic_store_uint32_t(&num_curves, n + 1);
+    }
+    else if (index < n && curve->owner.u64 && !same_curve(curves[index], curve))
+    {
+        curves[index]->next_retired = retired_curves;
+        retired_curves = curves[index];
+        curves[index] = curve;
+    }
+    else
+        unused = curve;
 
-    uint32_t tween_id = *(uint32_t *)tween_w.data;
-    const bool pause = pause_w.n > 0 ? *(bool *)pause_w.data : *tween_pause_default_value.boolean;
+    atomic_store_uint64_t(&curves_lock, 0);
 
-    tm_tween_item_o * item = find_tween_item(tween_id);
-    if (item)
+    if (unused)
+        tm_free(tm_allocator_api->system, unused, unused->bytes);
+    if (index == TM_TWEEN_MAX_CURVES)
     {
-        item->paused = pause;
+        tm_logger_api->printf(TM_LOG_TYPE_ERROR, "tm_tween_api: All %u custom curves are baked, easing with linear instead.\n", TM_TWEEN_MAX_CURVES);
+        return TM_TWEEN_EASING_ITEM_LINEAR;
     }
+    return TM_TWEEN_EASING_CUSTOM + index;
+}
 
-    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[PAUSE_TWEEN__OUT_EVENT]);
+static uint32_t bake_curve(const tm_tween_curve_point_t *points, uint32_t num_points)
+{
+    tween_curve_t *curve = new_curve(points, num_points);
+    return curve ? publish_curve(curve) : TM_TWEEN_EASING_ITEM_LINEAR;
 }
 
-static tm_graph_component_node_type_i pause_tween_node = {
-    .definition_path = __FILE__,
-    .name = "tm_pause_tween",
-    .category = TM_LOCALIZE_LATER("Tween"),
-    .static_connectors.in = {
-        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
-        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
-        { "pause", TM_TT_TYPE_HASH__BOOL },
-    },
-    .static_connectors.num_in = 3,
-    .static_connectors.out = {
-        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
-    },
-    .static_connectors.num_out = 1,
-    .run = tween_pause_f,
-};
-//----------------------------------------------------
-enum {
-    TWEEN_GET_FLOAT__TWEEN,
-    TWEEN_GET_FLOAT__OUT_GET_FLOAT,
-};
+static uint32_t cubic_bezier(float x1, float y1, float x2, float y2)
+{
+    const tm_tween_curve_point_t points[2] = {
+        { .x = 0.0f, .y = 0.0f, .out_x = x1, .out_y = y1 },
+        { .x = 1.0f, .y = 1.0f, .in_x = x2, .in_y = y2 },
+    };
+    return bake_curve(points, 2);
+}
 
-static void tween_get_float_f(tm_graph_interpreter_context_t *ctx)
+// Frees the baked curves when the plugin is unloaded.
+static void free_curves(void)
 {
-    const tm_graph_interpreter_wire_content_t tween_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[TWEEN_GET_FLOAT__TWEEN]);
+    const uint32_t n = atomic_load_uint32_t(&num_curves);
+    for (uint32_t c = 0; c < n; ++c)
+        tm_free(tm_allocator_api->system, curves[c], curves[c]->bytes);
+    atomic_store_uint32_t(&num_curves, 0);
 
-    if (tween_w.n == 0)
-        return;
+    while (retired_curves)
+    {
+        tween_curve_t *curve = retired_curves;
+        retired_curves = curve->next_retired;
+        tm_free(tm_allocator_api->system, curve, curve->bytes);
+    }
+}
 
-    uint32_t tween_id = *(uint32_t *)tween_w.data;
+static bool bind(tm_entity_t entity, tm_tween_t tween, uint32_t target, tm_strhash_t component, uint32_t offset)
+{
+    tm_tween_manager_o *manager = current_manager();
+    if (!manager)
+        return false;
 
-    float *float_value = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[TWEEN_GET_FLOAT__OUT_GET_FLOAT], 1, sizeof(*float_value));
-    *float_value = 0;
+    // Member bindings write the tween's floats at `offset`, which must lie inside the component.
+    tm_component_type_t member_type = { 0 };
+    uint32_t member_bytes = 0;
+    if (target == TM_TWEEN_TARGET_MEMBER)
+    {
+        uint32_t i;
+        if (!lookup(manager, tween, &i))
+            return false;
 
-    tm_tween_item_o * item = find_tween_item(tween_id);
-    if (item)
+        member_type = tm_entity_api->lookup_component_type(manager->ctx, component);
+        const tm_component_i *info = tm_entity_api->component(manager->ctx, member_type);
+        if (!info || (uint64_t)offset + num_components(manager, tween.index) * sizeof(float) > info->bytes)
+            return false;
+        member_bytes = info->bytes;
+    }
+
+    tm_tween_component_t *c = tm_entity_api->get_component(manager->ctx, entity, manager->tween_component);
+    if (!c)
+        c = tm_entity_api->add_component(manager->ctx, entity, manager->tween_component);
+    if (!c)
+        return false;
+
+    if (c->num_bindings == TM_TWEEN_COMPONENT_MAX_BINDINGS)
     {
-        if (item->elapsed < item->duration)
-        {
-            *float_value = item->from + (item->to - item->from) * item->easing(item->elapsed / item->duration);
-        }
-        else
+        uint32_t i;
+        for (uint32_t b = 0; b < c->num_bindings;)
         {
-            *float_value = item->to;
+            if (lookup(manager, c->bindings[b].tween, &i))
+                ++b;
+            else
+                c->bindings[b] = c->bindings[--c->num_bindings];
         }
+        if (c->num_bindings == TM_TWEEN_COMPONENT_MAX_BINDINGS)
+            return false;
     }
-}
 
-static tm_graph_component_node_type_i tween_get_float_node = {
-    .definition_path = __FILE__,
-    .name = "tm_tween_get_float",
-    .category = TM_LOCALIZE_LATER("Tween"),
-    .static_connectors.in = {
-        { "tween", TM_TT_TYPE_HASH__TWEEN_ITEM },
-    },
-    .static_connectors.num_in = 1,
-    .static_connectors.out = {
-        { "value", TM_TT_TYPE_HASH__FLOAT },
-    },
-    .static_connectors.num_out = 1,
-    .run = tween_get_float_f,
-};
-//----------------------------------------------------
-enum {
-    GET_TWEEN_VARIABLE__NAME,
-    GET_TWEEN_VARIABLE__OUT_VALUE,
-};
+    c->bindings[c->num_bindings++] = (tm_tween_binding_t){
+        .tween = tween,
+        .target = target,
+        .offset = offset,
+        .component = member_type,
+        .component_bytes = member_bytes,
+    };
+    return true;
+}
 
-static void get_tween_variable_node_f(tm_graph_interpreter_context_t *ctx)
+static bool then(tm_tween_t tween, tm_tween_t next)
 {
-    const tm_graph_interpreter_wire_content_t name_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[GET_TWEEN_VARIABLE__NAME]);
+    tm_tween_manager_o *manager = current_manager();
+    uint32_t i, n;
+    if (!counted_lookup(manager, TWEEN_COUNTERS__API, tween, &i) || !counted_lookup(manager, TWEEN_COUNTERS__API, next, &n) || i == n)
+        return false;
 
-    if (name_w.n == 0)
-        return;
+    add_successor(manager, tween.index, n);
+    return true;
+}
 
-    const tm_string_hash_t name = *(tm_string_hash_t *)name_w.data;
+static bool join(const tm_tween_t *tweens, uint32_t num_tweens, tm_tween_t next)
+{
+    tm_tween_manager_o *manager = current_manager();
+    uint32_t i, n;
+    if (!counted_lookup(manager, TWEEN_COUNTERS__API, next, &n))
+        return false;
 
-    uint32_t *value = tm_graph_interpreter_api->write_wire(ctx->interpreter, ctx->wires[GET_TWEEN_VARIABLE__OUT_VALUE], 1, sizeof(*value));
+    for (uint32_t t = 0; t < num_tweens; ++t)
+    {
+        if (!counted_lookup(manager, TWEEN_COUNTERS__API, tweens[t], &i) || i == n)
+            return false;
+    }
 
-    get_tween_variable(ctx, name, value);
+    for (uint32_t t = 0; t < num_tweens; ++t)
+        add_successor(manager, tweens[t].index, n);
+    return true;
 }
 
-static tm_graph_component_node_type_i get_tween_variable_node = {
-    .definition_path = __FILE__,
-    .name = "tm_get_tween_variable",
-    .category = TM_LOCALIZE_LATER("Graph Variables"),
-    .static_connectors.in = {
-        { "name", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING },
-    },
-    .static_connectors.num_in = 1,
-    .static_connectors.out = {
-        { "value", TM_TT_TYPE_HASH__TWEEN_ITEM },
-    },
-    .static_connectors.num_out = 1,
-    .run = get_tween_variable_node_f,
-};
-//----------------------------------------------------
-enum {
-    SET_TWEEN_VARIABLE__IN_EVENT,
-    SET_TWEEN_VARIABLE__NAME,
-    SET_TWEEN_VARIABLE__VALUE,
-    SET_TWEEN_VARIABLE__OUT_EVENT,
-};
+static void set_scheduler(const tm_tween_scheduler_i *scheduler)
+{
+    tm_tween_manager_o *manager = current_manager();
+    if (manager)
+        manager->scheduler = scheduler ? *scheduler : (tm_tween_scheduler_i){ 0 };
+}
 
-static void set_tween_variable_node_f(tm_graph_interpreter_context_t *ctx)
+static void set_parallel_threshold(uint32_t num_tweens)
 {
-    const tm_graph_interpreter_wire_content_t name_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[SET_TWEEN_VARIABLE__NAME]);
-    const tm_graph_interpreter_wire_content_t value_w = tm_graph_interpreter_api->read_wire(ctx->interpreter, ctx->wires[SET_TWEEN_VARIABLE__VALUE]);
+    tm_tween_manager_o *manager = current_manager();
+    if (manager)
+        manager->parallel_threshold = num_tweens;
+}
 
-    if (name_w.n == 0)
+static void set_easing_precision(uint32_t precision)
+{
+    tm_tween_manager_o *manager = current_manager();
+    if (!manager || precision >= TM_TWEEN_EASING_PRECISION_COUNT)
         return;
 
-    const tm_string_hash_t name = *(tm_string_hash_t *)name_w.data;
-    uint32_t value = *(uint32_t *)value_w.data;
+    manager->easing_precision = precision;
+    if (manager->cache_values)
+        evaluate_all_buckets(manager, manager->values);
+}
 
-    set_tween_variable(ctx, name, value);
+static bool create_group(tm_strhash_t name, tm_strhash_t parent)
+{
+    tm_tween_manager_o *manager = current_manager();
+    const uint32_t parent_index = find_group(manager, parent);
+    if (parent_index == TWEEN_NO_SLOT || find_group(manager, name) != TWEEN_NO_SLOT || tm_carray_size(manager->groups) == TWEEN_MAX_GROUPS)
+        return false;
 
-    tm_graph_interpreter_api->trigger_wire(ctx->interpreter, ctx->wires[SET_TWEEN_VARIABLE__OUT_EVENT]);
+    add_group(manager, name, parent_index);
+    return true;
 }
 
-static tm_graph_component_node_type_i set_tween_variable_node = {
-    .definition_path = __FILE__,
-    .name = "tm_set_tween_variable",
-    .category = TM_LOCALIZE_LATER("Graph Variables"),
-    .static_connectors.in = {
-        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
-        { "name", TM_TT_TYPE_HASH__STRING_HASH, TM_TT_TYPE_HASH__STRING },
-        { "value", TM_TT_TYPE_HASH__TWEEN_ITEM },
-    },
-    .static_connectors.num_in = 3,
-    .static_connectors.out = {
-        { "", TM_TT_TYPE_HASH__GRAPH_EVENT },
-    },
-    .static_connectors.num_out = 1,
-    .run = set_tween_variable_node_f,
-};
-//----------------------------------------------------
+static bool set_group(tm_tween_t tween, tm_strhash_t group)
+{
+    tm_tween_manager_o *manager = current_manager();
+    const uint32_t g = find_group(manager, group);
+    uint32_t i;
+    if (g == TWEEN_NO_SLOT || !counted_lookup(manager, TWEEN_COUNTERS__API, tween, &i))
+        return false;
 
-static void load_nodes(struct tm_api_registry_api* reg, bool load)
+    set_group_at(manager, i, g);
+    return true;
+}
+
+static void set_group_paused(tm_strhash_t group, bool paused)
 {
-    tm_graph_component_node_type_i* nodes[] = {
-        &tween_create_node,
-        &tween_get_float_node,
-        &tween_is_running_node,
-        &tween_is_paused_node,
-        &pause_tween_node,
-        &tween_destroy_node,
-        &get_tween_variable_node,
-        &set_tween_variable_node,
-    };
-    for (int i = 0; i != TM_ARRAY_COUNT(nodes); ++i)
-    {
-        tm_add_or_remove_implementation(reg, load, tm_graph_component_node_type_i, nodes[i]);
-    }
+    tm_tween_manager_o *manager = current_manager();
+    const uint32_t g = find_group(manager, group);
+    if (g != TWEEN_NO_SLOT)
+        manager->groups[g].paused = paused;
 }
 
-static tm_tween_item_o* create(float from, float to, float duration, easingFunction easing)
+static void set_group_time_scale(tm_strhash_t group, float time_scale)
 {
-    struct tm_tween_item_o item = {
-        .from = from,
-        .to = to,
-        .duration = duration,
-        .easing = easing,
-        .id = next_id++,
-        .paused = false,
-    };
-    tm_carray_push(tm_tween_api->manager->tweens, item, tm_allocator_api->system);
-    return tm_carray_last(tm_tween_api->manager->tweens);
+    tm_tween_manager_o *manager = current_manager();
+    const uint32_t g = find_group(manager, group);
+    if (g != TWEEN_NO_SLOT)
+        manager->groups[g].time_scale = time_scale;
+}
+
+// Returns true if group `g` is `ancestor` or one of its descendants. Parents come before their
+// children in `groups`.
+static bool group_within(const tm_tween_manager_o *manager, uint32_t g, uint32_t ancestor)
+{
+    while (g > ancestor)
+        g = manager->groups[g].parent;
+    return g == ancestor;
 }
 
-static void destroy(tm_tween_item_o* item)
+static uint32_t destroy_group_tweens(tm_strhash_t group)
 {
-    tm_tween_manager_o *manager = tm_tween_api->manager;
-    uint32_t n_tweens = (uint32_t)tm_carray_size(manager->tweens);
+    tm_tween_manager_o *manager = current_manager();
+    const uint32_t g = find_group(manager, group);
+    if (g == TWEEN_NO_SLOT)
+        return 0;
 
-    for (uint32_t i = 0; i < n_tweens; ++i)
+    uint32_t first = manager->num_tweens;
+    uint32_t num_destroyed = 0;
+    for (uint32_t i = 0; i < manager->num_tweens; ++i)
     {
-        if (manager->tweens[i].id == item->id)
+        if (manager->handle[i].u64 && group_within(manager, manager->group[i], g))
         {
-            if (i != n_tweens - 1)
-            {
-                tm_tween_item_o destroyed = manager->tweens[i];
-                manager->tweens[i] = manager->tweens[n_tweens - 1];
-                manager->tweens[n_tweens - 1] = destroyed;
-            }
-
-            tm_carray_shrink(manager->tweens, n_tweens - 1);
-            break;
+            clear_tween(manager, manager->handle[i], i);
+            first = i < first ? i : first;
+            ++num_destroyed;
         }
     }
+
+    if (num_destroyed)
+        remove_cleared(manager, first);
+    return num_destroyed;
+}
+
+static void reserve(uint32_t num_tweens)
+{
+    tm_tween_manager_o *manager = current_manager();
+    if (!manager)
+        return;
+
+    tm_allocator_i *a = &manager->counting_allocator;
+    if (num_tweens > manager->capacity)
+        set_capacity(manager, num_tweens);
+
+    tm_carray_ensure(manager->slots, num_tweens, a);
+    tm_carray_ensure(manager->groups[0].deadlines, num_tweens, a);
+    tm_carray_ensure(manager->job.finished_handles, num_tweens, a);
+
+    // Storage used by the parallel update, see `update_parallel()`.
+    if (!manager->scheduler.parallel_for || num_tweens < manager->parallel_threshold)
+        return;
+
+    if (!manager->has_scratch)
+    {
+        realloc_arrays(manager, &manager->scratch, 0, manager->capacity, 0);
+        manager->has_scratch = true;
+    }
+
+    const uint32_t num_chunks = (num_tweens + TWEEN_CHUNK_SIZE - 1) / TWEEN_CHUNK_SIZE;
+    const uint32_t num_items = num_chunks + TWEEN_NUM_BUCKETS;
+    tm_carray_ensure(manager->job.expired, (num_tweens + 63) / 64, a);
+    tm_carray_ensure(manager->job.finished, num_chunks + 1, a);
+    tm_carray_ensure(manager->job.edge_words, 2 * num_chunks, a);
+    tm_carray_ensure(manager->job.eval_items, 3 * num_items, a);
+    tm_carray_ensure(manager->job_decls, num_items, a);
+    tm_carray_ensure(manager->job_items, num_items, a);
+}
+
+static tm_tween_manager_o *context_manager(struct tm_entity_context_o *ctx)
+{
+    return find_manager(ctx);
+}
+
+static tm_tween_manager_o *set_thread_manager(tm_tween_manager_o *manager)
+{
+    tm_tween_manager_o *previous = thread_manager;
+    thread_manager = manager;
+    return previous;
+}
+
+static void allocation_stats(tm_tween_allocation_stats_t *stats)
+{
+    const tm_tween_manager_o *manager = current_manager();
+    *stats = manager ? manager->allocation_stats : (tm_tween_allocation_stats_t){ 0 };
+}
+
+static void stats(tm_tween_stats_t *res)
+{
+    const tm_tween_manager_o *manager = current_manager();
+    *res = manager ? manager->stats : (tm_tween_stats_t){ 0 };
 }
 
 static struct tm_tween_api api = {
     .create = create,
     .destroy = destroy,
+    .create_many = create_many,
+    .destroy_many = destroy_many,
+    .pause = pause_tween,
+    .set_repeat = set_repeat,
+    .enqueue_create = enqueue_create,
+    .enqueue_destroy = enqueue_destroy,
+    .enqueue_pause = enqueue_pause,
+    .ease = ease,
+    .evaluate_all = evaluate_all,
+    .set_value_cache = set_value_cache,
+    .cached_values = cached_values,
+    .get_float = get_float,
+    .get_float_many = get_float_many,
+    .create_vector = create_vector,
+    .get_vector = get_vector,
+    .set_snapshot = set_snapshot,
+    .read_snapshot = read_snapshot,
+    .finished = finished,
+    .compile_timeline = compile_timeline,
+    .create_timeline = create_timeline,
+    .bake_curve = bake_curve,
+    .cubic_bezier = cubic_bezier,
+    .then = then,
+    .join = join,
+    .bind = bind,
+    .set_scheduler = set_scheduler,
+    .set_parallel_threshold = set_parallel_threshold,
+    .set_easing_precision = set_easing_precision,
+    .create_group = create_group,
+    .set_group = set_group,
+    .set_group_paused = set_group_paused,
+    .set_group_time_scale = set_group_time_scale,
+    .destroy_group_tweens = destroy_group_tweens,
+    .reserve = reserve,
+    .context_manager = context_manager,
+    .set_thread_manager = set_thread_manager,
+    .allocation_stats = allocation_stats,
+    .stats = stats,
 };
 
+// Value of `TM_TT_PROP__EASING_ITEM__EASING` selecting the item's curve.
+#define TWEEN_EASING_ITEM_CURVE TM_TWEEN_EASING_ITEM_COUNT
+
 static const char *easing_item_names_array[] = {
     [TM_TWEEN_EASING_ITEM_LINEAR]       = "Linear",
     [TM_TWEEN_EASING_ITEM_INSINE]       = "In Sine",
@@ -632,11 +4439,17 @@ static const char *easing_item_names_array[] = {
     [TM_TWEEN_EASING_ITEM_INBOUNCE]     = "In Bounce",
     [TM_TWEEN_EASING_ITEM_OUTBOUNCE]    = "Out Bounce",
     [TM_TWEEN_EASING_ITEM_INOUTBOUNCE]  = "InOut Bounce",
+    [TWEEN_EASING_ITEM_CURVE]           = "Custom Curve",
 };
 
 static float ui_easing_object(struct tm_properties_ui_args_t *args, tm_rect_t item_rect, const char *name, const char *tooltip, tm_tt_id_t object, uint32_t indent)
 {
-    return tm_properties_view_api->ui_uint32_popup_picker(args, item_rect, name, tooltip, object, 0, easing_item_names_array, TM_ARRAY_COUNT(easing_item_names_array));
+    item_rect.y = tm_properties_view_api->ui_uint32_popup_picker(args, item_rect, name, tooltip, object, TM_TT_PROP__EASING_ITEM__EASING, easing_item_names_array, TM_ARRAY_COUNT(easing_item_names_array));
+
+    // The curve picker only shows once "Custom Curve" is selected.
+    if (tm_the_truth_api->get_uint32_t(args->tt, tm_tt_read(args->tt, object), TM_TT_PROP__EASING_ITEM__EASING) == TWEEN_EASING_ITEM_CURVE)
+        item_rect.y = tm_properties_view_api->ui_property_default(args, item_rect, object, indent + 1, TM_TT_PROP__EASING_ITEM__CURVE);
+    return item_rect.y;
 }
 
 static tm_properties_aspect_i *easing_type_properties_aspect = &(tm_properties_aspect_i){
@@ -645,9 +4458,82 @@ static tm_properties_aspect_i *easing_type_properties_aspect = &(tm_properties_a
 
 static void create_truth_types(struct tm_the_truth_o *tt)
 {
-    tm_the_truth_property_definition_t easing_item_properties[] = { { "easing", TM_THE_TRUTH_PROPERTY_TYPE_UINT32_T } };
+    tm_the_truth_property_definition_t curve_point_properties[] = {
+        [TM_TT_PROP__TWEEN_CURVE_POINT__X] = { "x", TM_THE_TRUTH_PROPERTY_TYPE_FLOAT },
+        [TM_TT_PROP__TWEEN_CURVE_POINT__Y] = { "y", TM_THE_TRUTH_PROPERTY_TYPE_FLOAT },
+        [TM_TT_PROP__TWEEN_CURVE_POINT__IN_X] = { "in_x", TM_THE_TRUTH_PROPERTY_TYPE_FLOAT },
+        [TM_TT_PROP__TWEEN_CURVE_POINT__IN_Y] = { "in_y", TM_THE_TRUTH_PROPERTY_TYPE_FLOAT },
+        [TM_TT_PROP__TWEEN_CURVE_POINT__OUT_X] = { "out_x", TM_THE_TRUTH_PROPERTY_TYPE_FLOAT },
+        [TM_TT_PROP__TWEEN_CURVE_POINT__OUT_Y] = { "out_y", TM_THE_TRUTH_PROPERTY_TYPE_FLOAT },
+    };
+    tm_the_truth_api->create_object_type(tt, TM_TT_TYPE__TWEEN_CURVE_POINT, curve_point_properties, TM_ARRAY_COUNT(curve_point_properties));
+
+    tm_the_truth_property_definition_t curve_properties[] = {
+        [TM_TT_PROP__TWEEN_CURVE__POINTS] = { "points", TM_THE_TRUTH_PROPERTY_TYPE_SUBOBJECT_SET, .type_hash = TM_TT_TYPE_HASH__TWEEN_CURVE_POINT },
+    };
+    tm_the_truth_api->create_object_type(tt, TM_TT_TYPE__TWEEN_CURVE, curve_properties, TM_ARRAY_COUNT(curve_properties));
+
+    tm_the_truth_property_definition_t easing_item_properties[] = {
+        [TM_TT_PROP__EASING_ITEM__EASING] = { "easing", TM_THE_TRUTH_PROPERTY_TYPE_UINT32_T },
+        [TM_TT_PROP__EASING_ITEM__CURVE] = { "curve", TM_THE_TRUTH_PROPERTY_TYPE_REFERENCE, .type_hash = TM_TT_TYPE_HASH__TWEEN_CURVE },
+    };
     const tm_tt_type_t easing_type = tm_the_truth_api->create_object_type(tt, TM_TT_TYPE__EASING_ITEM, easing_item_properties, TM_ARRAY_COUNT(easing_item_properties));
     tm_the_truth_api->set_aspect(tt, easing_type, TM_TT_ASPECT__PROPERTIES, easing_type_properties_aspect);
+
+    tm_the_truth_property_definition_t keyframe_properties[] = {
+        [TM_TT_PROP__TWEEN_KEYFRAME__TIME] = { "time", TM_THE_TRUTH_PROPERTY_TYPE_FLOAT },
+        [TM_TT_PROP__TWEEN_KEYFRAME__VALUE] = { "value", TM_THE_TRUTH_PROPERTY_TYPE_FLOAT },
+        [TM_TT_PROP__TWEEN_KEYFRAME__EASING] = { "easing", TM_THE_TRUTH_PROPERTY_TYPE_SUBOBJECT, .type_hash = TM_TT_TYPE_HASH__EASING_ITEM },
+    };
+    tm_the_truth_api->create_object_type(tt, TM_TT_TYPE__TWEEN_KEYFRAME, keyframe_properties, TM_ARRAY_COUNT(keyframe_properties));
+
+    tm_the_truth_property_definition_t timeline_properties[] = {
+        [TM_TT_PROP__TWEEN_TIMELINE__KEYFRAMES] = { "keyframes", TM_THE_TRUTH_PROPERTY_TYPE_SUBOBJECT_SET, .type_hash = TM_TT_TYPE_HASH__TWEEN_KEYFRAME },
+    };
+    tm_the_truth_api->create_object_type(tt, TM_TT_TYPE__TWEEN_TIMELINE, timeline_properties, TM_ARRAY_COUNT(timeline_properties));
+}
+
+// Returns the easing value of the easing item `easing_id`, baking its curve if it uses one, so
+// custom curves cost nothing to set up when the graph runs.
+static uint32_t compile_easing_item(const tm_the_truth_o *tt, tm_tt_id_t easing_id)
+{
+    if (!easing_id.u64)
+        return TM_TWEEN_EASING_ITEM_LINEAR;
+
+    const tm_the_truth_object_o *easing_r = tm_tt_read(tt, easing_id);
+    const uint32_t easing = tm_the_truth_api->get_uint32_t(tt, easing_r, TM_TT_PROP__EASING_ITEM__EASING);
+    if (easing != TWEEN_EASING_ITEM_CURVE)
+        return easing;
+
+    const tm_tt_id_t curve_id = tm_the_truth_api->get_reference(tt, easing_r, TM_TT_PROP__EASING_ITEM__CURVE);
+    if (!curve_id.u64)
+        return TM_TWEEN_EASING_ITEM_LINEAR;
+
+    TM_INIT_TEMP_ALLOCATOR(ta);
+    const tm_tt_id_t *ids = tm_the_truth_api->get_subobject_set(tt, tm_tt_read(tt, curve_id), TM_TT_PROP__TWEEN_CURVE__POINTS, ta);
+    const uint32_t n = (uint32_t)tm_carray_size(ids);
+    tm_tween_curve_point_t *points = tm_temp_alloc(ta, n * sizeof(*points));
+    for (uint32_t k = 0; k < n; ++k)
+    {
+        const tm_the_truth_object_o *point_r = tm_tt_read(tt, ids[k]);
+        points[k] = (tm_tween_curve_point_t){
+            .x = tm_the_truth_api->get_float(tt, point_r, TM_TT_PROP__TWEEN_CURVE_POINT__X),
+            .y = tm_the_truth_api->get_float(tt, point_r, TM_TT_PROP__TWEEN_CURVE_POINT__Y),
+            .in_x = tm_the_truth_api->get_float(tt, point_r, TM_TT_PROP__TWEEN_CURVE_POINT__IN_X),
+            .in_y = tm_the_truth_api->get_float(tt, point_r, TM_TT_PROP__TWEEN_CURVE_POINT__IN_Y),
+            .out_x = tm_the_truth_api->get_float(tt, point_r, TM_TT_PROP__TWEEN_CURVE_POINT__OUT_X),
+            .out_y = tm_the_truth_api->get_float(tt, point_r, TM_TT_PROP__TWEEN_CURVE_POINT__OUT_Y),
+        };
+    }
+    tween_curve_t *curve = new_curve(points, n);
+    TM_SHUTDOWN_TEMP_ALLOCATOR(ta);
+    if (!curve)
+        return TM_TWEEN_EASING_ITEM_LINEAR;
+
+    // The curve object keeps its easing value across edits, so recompiling doesn't fill the table.
+    curve->owner_tt = tt;
+    curve->owner = curve_id;
+    return publish_curve(curve);
 }
 
 static bool compile_data_to_wire(tm_graph_interpreter_o *gr, uint32_t wire, const tm_the_truth_o *tt, tm_tt_id_t data_id, tm_strhash_t to_type_hash)
@@ -658,7 +4544,27 @@ static bool compile_data_to_wire(tm_graph_interpreter_o *gr, uint32_t wire, cons
 
     if (TM_STRHASH_EQUAL(type_hash, TM_TT_TYPE_HASH__EASING_ITEM) && TM_STRHASH_EQUAL(to_type_hash, TM_TT_TYPE_HASH__UINT32_T)) {
         uint32_t *v = (uint32_t *)tm_graph_interpreter_api->write_wire(gr, wire, 1, sizeof(uint32_t));
-        *v = tm_the_truth_api->get_uint32_t(tt, data_r, 0);
+        *v = compile_easing_item(tt, data_id);
+        return true;
+    }
+
+    // Timelines go on the wire as raw keyframes, `tm_tween_api->compile_timeline()` sorts them and
+    // shares the result between instances.
+    if (TM_STRHASH_EQUAL(type_hash, TM_TT_TYPE_HASH__TWEEN_TIMELINE) && TM_STRHASH_EQUAL(to_type_hash, TM_TT_TYPE_HASH__TWEEN_TIMELINE)) {
+        TM_INIT_TEMP_ALLOCATOR(ta);
+        const tm_tt_id_t *ids = tm_the_truth_api->get_subobject_set(tt, data_r, TM_TT_PROP__TWEEN_TIMELINE__KEYFRAMES, ta);
+        const uint32_t n = (uint32_t)tm_carray_size(ids);
+        tm_tween_keyframe_t *keys = (tm_tween_keyframe_t *)tm_graph_interpreter_api->write_wire(gr, wire, n, sizeof(tm_tween_keyframe_t));
+        for (uint32_t k = 0; k < n; ++k) {
+            const tm_the_truth_object_o *key_r = tm_tt_read(tt, ids[k]);
+            const tm_tt_id_t easing_id = tm_the_truth_api->get_subobject(tt, key_r, TM_TT_PROP__TWEEN_KEYFRAME__EASING);
+            keys[k] = (tm_tween_keyframe_t){
+                .time = tm_the_truth_api->get_float(tt, key_r, TM_TT_PROP__TWEEN_KEYFRAME__TIME),
+                .value = tm_the_truth_api->get_float(tt, key_r, TM_TT_PROP__TWEEN_KEYFRAME__VALUE),
+                .easing = compile_easing_item(tt, easing_id),
+            };
+        }
+        TM_SHUTDOWN_TEMP_ALLOCATOR(ta);
         return true;
     }
 
@@ -673,6 +4579,9 @@ TM_DLL_EXPORT void tm_load_plugin(struct tm_api_registry_api* reg, bool load)
     tm_graph_interpreter_api = tm_get_api(reg, tm_graph_interpreter_api);
     tm_properties_view_api = tm_get_api(reg, tm_properties_view_api);
     tm_localizer_api = tm_get_api(reg, tm_localizer_api);
+    tm_job_system_api = tm_get_api(reg, tm_job_system_api);
+    tm_temp_allocator_api = tm_get_api(reg, tm_temp_allocator_api);
+    tm_profiler_api = tm_get_api(reg, tm_profiler_api);
     tm_allocator_api = tm_get_api(reg, tm_allocator_api);
     tm_tween_api = tm_get_api(reg, tm_tween_api);
 
@@ -680,7 +4589,13 @@ TM_DLL_EXPORT void tm_load_plugin(struct tm_api_registry_api* reg, bool load)
 
     tm_add_or_remove_implementation(reg, load, tm_the_truth_create_types_i, create_truth_types);
     tm_add_or_remove_implementation(reg, load, tm_graph_component_compile_data_i, compile_data_to_wire);
+    tm_add_or_remove_implementation(reg, load, tm_entity_create_component_i, create_tween_component);
     tm_add_or_remove_implementation(reg, load, tm_entity_register_engines_simulation_i, register_tween_system);
 
     load_nodes(reg, load);
+
+    if (load)
+        build_easing_tables();
+    else
+        free_curves();
 }
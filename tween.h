@@ -1,27 +1,410 @@
 #pragma once
 
+#include <foundation/api_types.h>
+#include <plugins/entity/entity.h>
+
 typedef struct tm_tween_manager_o tm_tween_manager_o;
-typedef struct tm_tween_item_o tm_tween_item_o;
 
 typedef double (*easingFunction)(double);
 
+// Handle to a tween. `index` addresses a slot in the manager's handle table and `generation` is
+// bumped every time that slot is freed, so handles to destroyed tweens are detected instead of
+// aliasing whatever tween reuses the slot. The zero handle is never valid.
+typedef struct tm_tween_t
+{
+    union {
+        struct {
+            uint32_t index;
+            uint32_t generation;
+        };
+        uint64_t u64;
+    };
+} tm_tween_t;
+
+// Runs the data-parallel phases of the tween update. `parallel_for()` must call `task(data, i)`
+// once for every `i` in `[0, n)`, in any order and on any threads, and return when all calls have
+// finished.
+typedef struct tm_tween_scheduler_i
+{
+    void *inst;
+    void (*parallel_for)(void *inst, void (*task)(void *data, uint32_t i), void *data, uint32_t n);
+} tm_tween_scheduler_i;
+
+// Allocation counters of the tween manager, see `tm_tween_api->allocation_stats()`.
+typedef struct tm_tween_allocation_stats_t
+{
+    // Number of allocations and reallocations, and of frees.
+    uint64_t num_allocations;
+    uint64_t num_frees;
+
+    // Bytes currently allocated and the most ever allocated at once.
+    uint64_t allocated_bytes;
+    uint64_t peak_allocated_bytes;
+} tm_tween_allocation_stats_t;
+
+// Counters of the tween manager, see `tm_tween_api->stats()`. Counts cover one frame: the last
+// tween update and everything since the update before it.
+typedef struct tm_tween_stats_t
+{
+    // Tweens alive after the update.
+    uint32_t num_active;
+
+    uint32_t num_created;
+    uint32_t num_finished;
+    uint32_t num_destroyed;
+
+    // Handle lookups by the API, the graph nodes and the binding engines, and those that found a
+    // stale handle.
+    uint32_t num_lookups;
+    uint32_t num_lookup_misses;
+
+    // Bytes held by the manager after the update.
+    uint64_t allocated_bytes;
+} tm_tween_stats_t;
+
+// Keyframe of a timeline. `easing` shapes the segment from this keyframe to the next one.
+typedef struct tm_tween_keyframe_t
+{
+    float time;
+    float value;
+    uint32_t easing;
+} tm_tween_keyframe_t;
+
+// Compiled, immutable keyframe array shared by all the tweens playing it. Zero is no timeline.
+typedef struct tm_tween_timeline_t
+{
+    uint32_t u32;
+} tm_tween_timeline_t;
+
+// Point of a custom easing curve, see `tm_tween_api->bake_curve()`. `x` is the progress of the
+// tween and `y` the eased progress. The segment between two points is a cubic Bezier curve that
+// leaves the first point towards its `out` handle and enters the second from its `in` handle.
+// Handles are absolute positions, like the control points of CSS `cubic-bezier()`.
+typedef struct tm_tween_curve_point_t
+{
+    float x;
+    float y;
+    float in_x;
+    float in_y;
+    float out_x;
+    float out_y;
+} tm_tween_curve_point_t;
+
+// A field a tween writes through the tween component, see `tm_tween_api->bind()`.
+typedef struct tm_tween_binding_t
+{
+    tm_tween_t tween;
+
+    // A `tm_tween_target` value.
+    uint32_t target;
+
+    // For `TM_TWEEN_TARGET_MEMBER`, byte offset of the first float written in `component`.
+    uint32_t offset;
+    tm_component_type_t component;
+
+    // For `TM_TWEEN_TARGET_MEMBER`, size of `component`. Writes never go past it.
+    uint32_t component_bytes;
+    TM_PAD(4);
+} tm_tween_binding_t;
+
+#define TM_TWEEN_COMPONENT_MAX_BINDINGS 4
+
+// Runtime component holding the tween bindings of an entity. Bindings whose tween is gone are
+// dropped by the tween engines.
+typedef struct tm_tween_component_t
+{
+    tm_tween_binding_t bindings[TM_TWEEN_COMPONENT_MAX_BINDINGS];
+    uint32_t num_bindings;
+    TM_PAD(4);
+} tm_tween_component_t;
+
+// Every entity context with a tween system has its own tween manager, with its own tweens,
+// handles and clock. The API functions operate on the calling thread's manager, set with
+// `set_thread_manager()`, or on `manager` if the thread has none. Graph nodes use the manager of
+// their graph's entity context. Managers of different contexts share no state, so their contexts
+// can update in parallel. Without a manager, when no entity context has a tween system or after
+// the thread's manager was cleared at shutdown, the functions do nothing and return the zero
+// handle, 0 or false, and the stats functions write zeroes.
 struct tm_tween_api
 {
-	tm_tween_item_o* (*create)(float from, float to, float duration, easingFunction easing);
-	void (*destroy)(tm_tween_item_o* item);
+	// Manager of the most recently created entity context that still exists.
+	tm_tween_manager_o *manager;
+
+	// Creates a tween going from `from` to `to` over `duration` seconds. `easing` is one of the
+	// `tm_tween_easing_item` values or a curve from `bake_curve()`.
+	tm_tween_t (*create)(float from, float to, float duration, uint32_t easing);
+
+	// Destroys the tween. Does nothing if the handle is stale.
+	void (*destroy)(tm_tween_t tween);
+
+	// Pauses or resumes the tween, keeping its progress. Returns false if the handle is stale.
+	bool (*pause)(tm_tween_t tween, bool paused);
+
+	// Makes the tween play `repeats` more cycles after the current one, or loop until destroyed
+	// with `TM_TWEEN_REPEAT_FOREVER`, zero stops after the current cycle. `mode` is a
+	// `tm_tween_repeat_mode`. Cycles wrap inside the update, keeping the time the previous cycle
+	// overshot its end, however many cycles one time step spans, so the tween keeps its handle and
+	// loops stay in phase at any frame rate. The tween finishes, and its successors start, after
+	// the last cycle; a yoyo tween stopped on a backward cycle ends at `from`. A cycle shorter
+	// than the resolution of the group clock wraps at most once per update. Returns false if the
+	// handle is stale or the duration isn't positive.
+	bool (*set_repeat)(tm_tween_t tween, uint32_t repeats, uint32_t mode);
+
+	// Creates `num_tweens` tweens in `group`, the zero hash for the root group, the `k`th one as
+	// `create(from[k], to[k], duration[k], easing[k])` would, and writes their handles to `tweens`.
+	// Storage for all of them is reserved up front and the easing buckets are rearranged once.
+	// Returns false, creating nothing, if `group` doesn't exist.
+	bool (*create_many)(const float *from, const float *to, const float *duration, const uint32_t *easing, uint32_t num_tweens, tm_strhash_t group, tm_tween_t *tweens);
+
+	// Destroys the tweens in `tweens`, skipping stale handles, and returns the number destroyed.
+	// Large batches are removed in one pass over the tween storage.
+	uint32_t (*destroy_many)(const tm_tween_t *tweens, uint32_t num_tweens);
+
+	// Versions of `create()`, `destroy()` and `pause()` that are safe to call from any thread,
+	// concurrently with each other and with the tween system update, without taking a lock. They
+	// queue a command that the next update runs, in queue order, before advancing time.
+	// `enqueue_create()` returns the handle the tween will have; until the update creates it, the
+	// other functions treat that handle as stale. They return the zero handle or false if the
+	// queue is full. The other functions are meant for the thread running the update.
+	tm_tween_t (*enqueue_create)(float from, float to, float duration, uint32_t easing);
+	bool (*enqueue_destroy)(tm_tween_t tween);
+	bool (*enqueue_pause)(tm_tween_t tween, bool paused);
+
+	// Evaluates the easing curve `easing` for the `n` progress values in `t` (expected in [0, 1])
+	// and writes the results to `res`. Uses 8-wide AVX2/FMA kernels when the plugin is built with
+	// them; see easing.inl for the error bound against the scalar curves.
+	void (*ease)(uint32_t easing, const float *t, float *res, uint32_t n);
+
+	// Evaluates every live tween into `values` and, if `tweens` is non-NULL, writes the matching
+	// handles to `tweens`. Tweens are evaluated grouped by easing curve, one batch per curve.
+	// Returns the number of live tweens; nothing is written if that is more than `capacity`.
+	uint32_t (*evaluate_all)(float *values, tm_tween_t *tweens, uint32_t capacity);
+
+	// Enables or disables the value cache. While it is enabled, the tween system evaluates every
+	// live tween once per frame, after advancing time, and value reads come from that buffer
+	// instead of evaluating the easing curve again.
+	void (*set_value_cache)(bool enabled);
+
+	// Returns the number of live tweens and points `values` at their cached values and `tweens` (if
+	// non-NULL) at the matching handles. Returns 0 when the value cache is disabled. The arrays are
+	// invalidated by the next create, destroy or update.
+	uint32_t (*cached_values)(const float **values, const tm_tween_t **tweens);
+
+	// Writes the current value of `tween` to `value`, from the cache when it is enabled. Returns
+	// false and leaves `value` untouched if the handle is stale. For vector tweens this is the
+	// eased progress, which is also what the value cache holds for them. For timeline tweens it is
+	// the keyframe curve at the playhead; the value cache holds the playhead in seconds.
+	bool (*get_float)(tm_tween_t tween, float *value);
+
+	// Writes the values `get_float()` reads for `tweens` to `values`, zero for stale handles, and
+	// returns the number of live tweens.
+	uint32_t (*get_float_many)(const tm_tween_t *tweens, uint32_t num_tweens, float *values);
+
+	// Creates a tween of a `tm_tween_value_type` going from `from` to `to`, using the leading
+	// components for two and three component types. All components share one timer and one easing
+	// evaluation. Quaternions are normalized and interpolated along the shortest arc. Colors are
+	// given in sRGB and interpolated in linear space; alpha is interpolated as is.
+	tm_tween_t (*create_vector)(uint32_t type, tm_vec4_t from, tm_vec4_t to, float duration, uint32_t easing);
+
+	// Writes the current value of `tween` to `value`. Unused components are zero and float tweens
+	// write their value to `x`. Returns false if the handle is stale.
+	bool (*get_vector)(tm_tween_t tween, tm_vec4_t *value);
+
+	// Enables or disables the snapshot. While it is enabled, each tween system update ends by
+	// publishing the value of every live tween, as `get_vector()` would read it, for readers on
+	// other threads. An update that finds a reader still inside the buffer it would overwrite
+	// skips publishing rather than wait, so the previous snapshot stays up one update longer.
+	// Disabling it leaves the last published values in place.
+	void (*set_snapshot)(bool enabled);
+
+	// Writes the values the last published snapshot holds for `tweens` to `values`, zero for
+	// tweens that were not alive when it was taken, and returns the number that were. Safe to call
+	// from any thread, also while the update runs, and wait-free: all values come from the same
+	// update and nothing the update does blocks or tears the read.
+	uint32_t (*read_snapshot)(const tm_tween_t *tweens, uint32_t num_tweens, tm_vec4_t *values);
+
+	// Points `tweens` at the handles of the tweens the last update removed because they finished,
+	// in the order they finished, and returns their number. Destroyed tweens are not included. The
+	// array is valid until the next update.
+	uint32_t (*finished)(const tm_tween_t **tweens);
+
+	// Compiles `keys` into a timeline, sorting them by time. Identical keyframe arrays compile to
+	// the same timeline, so instances spawned from the same asset share one buffer. Timelines live
+	// as long as the manager. Returns the zero timeline if `num_keys` is 0.
+	tm_tween_timeline_t (*compile_timeline)(const tm_tween_keyframe_t *keys, uint32_t num_keys);
+
+	// Creates a tween playing `timeline` from its start. It runs until the time of the last
+	// keyframe and `get_float()` returns the keyframe curve at its playhead. Returns the zero handle
+	// if `timeline` is invalid.
+	tm_tween_t (*create_timeline)(tm_tween_timeline_t timeline);
+
+	// Bakes a custom easing curve through `points` and returns the easing value selecting it, to
+	// pass wherever an `easing` is taken. Points are sorted by `x` and handles are clamped to the
+	// `x` range of their segment, so the curve is a function of progress. Each segment is baked
+	// into a small table that evaluation refines with Newton steps. Baked curves are shared by
+	// every manager and live until the plugin is unloaded; identical curves share one easing
+	// value. The curve of an easing item in The Truth keeps one easing value while it is edited,
+	// each edit replaces the shape behind it. Returns `TM_TWEEN_EASING_ITEM_LINEAR` if fewer than
+	// two points have distinct `x`, or logs an error and returns it if `TM_TWEEN_MAX_CURVES`
+	// curves are already baked.
+	uint32_t (*bake_curve)(const tm_tween_curve_point_t *points, uint32_t num_points);
+
+	// Bakes the CSS `cubic-bezier(x1, y1, x2, y2)` curve from (0, 0) to (1, 1), see `bake_curve()`.
+	uint32_t (*cubic_bezier)(float x1, float y1, float x2, float y2);
+
+	// Holds `next` paused until `tween` finishes, then starts it in the same update with the time
+	// `tween` overshot its end already elapsed, so chains don't drift. A tween waiting for several
+	// others starts when the last one finishes. Destroying a tween releases the tweens waiting for
+	// it as if it had finished. `pause()` on a waiting tween decides whether it plays once it is
+	// released: a tween paused by the user gets the overshoot as progress but stays paused until
+	// resumed. Returns false if either handle is stale or both are the same. Waiting must not form
+	// a cycle.
+	bool (*then)(tm_tween_t tween, tm_tween_t next);
+
+	// Makes `next` wait for all of `tweens`, see `then()`. Returns false, changing nothing, if any
+	// handle is stale.
+	bool (*join)(const tm_tween_t *tweens, uint32_t num_tweens, tm_tween_t next);
+
+	// Makes the tween engines write the value of `tween` to a field of `entity` every frame after
+	// the tween system update, adding a tween component to the entity if it has none. `target` is
+	// a `tm_tween_target`; `component` and `offset` are only used by `TM_TWEEN_TARGET_MEMBER`,
+	// which writes as many floats as the tween has components. Float tweens bound to a position or
+	// scale set all three axes. Returns false if the entity already has
+	// `TM_TWEEN_COMPONENT_MAX_BINDINGS` live bindings, and for `TM_TWEEN_TARGET_MEMBER` if the
+	// tween is stale, `component` is unknown or the floats written at `offset` don't fit in it.
+	bool (*bind)(tm_entity_t entity, tm_tween_t tween, uint32_t target, tm_strhash_t component, uint32_t offset);
+
+	// Replaces the scheduler used to update large tween sets in parallel. The default one runs on
+	// the job system. Passing NULL, or a scheduler without `parallel_for`, makes updates serial.
+	void (*set_scheduler)(const tm_tween_scheduler_i *scheduler);
+
+	// Sets the number of live tweens from which updates go through the scheduler. Below it the
+	// update runs serially on the calling thread.
+	void (*set_parallel_threshold)(uint32_t num_tweens);
+
+	// Sets the `tm_tween_easing_precision` used to evaluate built-in curves one tween at a time:
+	// value reads while the value cache is disabled, and timeline keyframes. The default is exact.
+	// Batch evaluation, which also fills the value cache, always uses the single precision
+	// kernels, or the tables when the plugin is built without AVX2 and the precision is
+	// `TM_TWEEN_EASING_PRECISION_TABLE`. Custom curves are not affected.
+	void (*set_easing_precision)(uint32_t precision);
+
+	// Creates the tween group `name` under the group `parent`, where the zero hash names the root
+	// group that new tweens start in. Each group has its own clock, advanced by the update time
+	// step times the time scales of the group and its ancestors, and stopped while the group or an
+	// ancestor is paused. Returns false if `name` already exists or `parent` doesn't.
+	bool (*create_group)(tm_strhash_t name, tm_strhash_t parent);
+
+	// Moves `tween` to `group`, keeping its progress. Returns false if either doesn't exist.
+	bool (*set_group)(tm_tween_t tween, tm_strhash_t group);
+
+	// Pauses or resumes every tween in the group and its descendants, in constant time.
+	void (*set_group_paused)(tm_strhash_t group, bool paused);
+
+	// Sets the speed of the group's clock relative to its parent's, in constant time.
+	void (*set_group_time_scale)(tm_strhash_t group, float time_scale);
+
+	// Destroys every tween in the group and its descendants, in one pass over the tween storage,
+	// and returns their number. Groups double as tags: put the tweens of one animation in their
+	// own group to tear them down together. The groups themselves remain.
+	uint32_t (*destroy_group_tweens)(tm_strhash_t group);
+
+	// Grows the tween storage, and the bookkeeping the update needs, to hold `num_tweens` tweens
+	// without allocating. Storage is allocated from the entity context's allocator and never
+	// shrinks while the context lives.
+	void (*reserve)(uint32_t num_tweens);
+
+	// Copies the manager's allocation counters to `stats`.
+	void (*allocation_stats)(tm_tween_allocation_stats_t *stats);
+
+	// Returns the tween manager of the entity context `ctx`, or NULL if it has none.
+	tm_tween_manager_o *(*context_manager)(struct tm_entity_context_o *ctx);
+
+	// Makes the API functions called from this thread use `manager`, or `manager` of this API
+	// again if NULL. Returns the manager the thread used before.
+	tm_tween_manager_o *(*set_thread_manager)(tm_tween_manager_o *manager);
+
+	// Fills `stats` with the counters of the last frame, or zeroes if there is no tween manager.
+	void (*stats)(tm_tween_stats_t *stats);
 };
 
-#define tm_tween_api_version TM_VERSION(1, 0, 0)
+#define tm_tween_api_version TM_VERSION(2, 17, 0)
 
 #define TM_TT_TYPE__TWEEN_ITEM "tm_tween_item"
 #define TM_TT_TYPE_HASH__TWEEN_ITEM TM_STATIC_HASH("tm_tween_item", 0x13a429408501296aULL)
 
+#define TM_TT_TYPE__TWEEN_VEC2_ITEM "tm_tween_vec2_item"
+#define TM_TT_TYPE_HASH__TWEEN_VEC2_ITEM TM_STATIC_HASH("tm_tween_vec2_item", 0x1f1da8b1afe68059ULL)
+
+#define TM_TT_TYPE__TWEEN_VEC3_ITEM "tm_tween_vec3_item"
+#define TM_TT_TYPE_HASH__TWEEN_VEC3_ITEM TM_STATIC_HASH("tm_tween_vec3_item", 0xfc1ff519facf5cefULL)
+
+#define TM_TT_TYPE__TWEEN_VEC4_ITEM "tm_tween_vec4_item"
+#define TM_TT_TYPE_HASH__TWEEN_VEC4_ITEM TM_STATIC_HASH("tm_tween_vec4_item", 0x14fc1db81200e604ULL)
+
+#define TM_TT_TYPE__TWEEN_QUATERNION_ITEM "tm_tween_quaternion_item"
+#define TM_TT_TYPE_HASH__TWEEN_QUATERNION_ITEM TM_STATIC_HASH("tm_tween_quaternion_item", 0xf8649d03706852fbULL)
+
+#define TM_TT_TYPE__TWEEN_COLOR_ITEM "tm_tween_color_item"
+#define TM_TT_TYPE_HASH__TWEEN_COLOR_ITEM TM_STATIC_HASH("tm_tween_color_item", 0xa9b4ec1cfaf273e3ULL)
+
+#define TM_TT_TYPE__TWEEN_KEYFRAME "tm_tween_keyframe"
+#define TM_TT_TYPE_HASH__TWEEN_KEYFRAME TM_STATIC_HASH("tm_tween_keyframe", 0xfc5ac8434f6bf148ULL)
+
+#define TM_TT_TYPE__TWEEN_TIMELINE "tm_tween_timeline"
+#define TM_TT_TYPE_HASH__TWEEN_TIMELINE TM_STATIC_HASH("tm_tween_timeline", 0xdbd394cca207b8b9ULL)
+
+enum {
+    TM_TT_PROP__TWEEN_KEYFRAME__TIME, // float
+    TM_TT_PROP__TWEEN_KEYFRAME__VALUE, // float
+    TM_TT_PROP__TWEEN_KEYFRAME__EASING, // subobject [[TM_TT_TYPE__EASING_ITEM]]
+};
+
+enum {
+    TM_TT_PROP__TWEEN_TIMELINE__KEYFRAMES, // subobject_set [[TM_TT_TYPE__TWEEN_KEYFRAME]]
+};
+
+#define TM_TT_TYPE__TWEEN_CURVE_POINT "tm_tween_curve_point"
+#define TM_TT_TYPE_HASH__TWEEN_CURVE_POINT TM_STATIC_HASH("tm_tween_curve_point", 0xa7271cb516eee21aULL)
+
+#define TM_TT_TYPE__TWEEN_CURVE "tm_tween_curve"
+#define TM_TT_TYPE_HASH__TWEEN_CURVE TM_STATIC_HASH("tm_tween_curve", 0xe2338902b544ee30ULL)
+
+// See `tm_tween_curve_point_t`.
+enum {
+    TM_TT_PROP__TWEEN_CURVE_POINT__X, // float
+    TM_TT_PROP__TWEEN_CURVE_POINT__Y, // float
+    TM_TT_PROP__TWEEN_CURVE_POINT__IN_X, // float
+    TM_TT_PROP__TWEEN_CURVE_POINT__IN_Y, // float
+    TM_TT_PROP__TWEEN_CURVE_POINT__OUT_X, // float
+    TM_TT_PROP__TWEEN_CURVE_POINT__OUT_Y, // float
+};
+
+enum {
+    TM_TT_PROP__TWEEN_CURVE__POINTS, // subobject_set [[TM_TT_TYPE__TWEEN_CURVE_POINT]]
+};
+
 #define TM_TT_TYPE__EASING_ITEM "tm_easing_item"
 #define TM_TT_TYPE_HASH__EASING_ITEM TM_STATIC_HASH("tm_easing_item", 0xea6caf6c94635110ULL)
 
+enum {
+    // A `tm_tween_easing_item` value, or `TM_TWEEN_EASING_ITEM_COUNT` to use `curve`.
+    TM_TT_PROP__EASING_ITEM__EASING, // uint32_t
+    TM_TT_PROP__EASING_ITEM__CURVE, // reference [[TM_TT_TYPE__TWEEN_CURVE]]
+};
+
 #define TM_TWEEN_SYSTEM "tm_tween_system"
 #define TM_TWEEN_SYSTEM_HASH TM_STATIC_HASH("tm_tween_system", 0xf3dd3e4ba4a2a5d5ULL)
 
+#define TM_TT_TYPE__TWEEN_COMPONENT "tm_tween_component"
+#define TM_TT_TYPE_HASH__TWEEN_COMPONENT TM_STATIC_HASH("tm_tween_component", 0x964fdb92b90aa672ULL)
+
+#define TM_TWEEN_TRANSFORM_ENGINE "tm_tween_transform_engine"
+#define TM_TWEEN_TRANSFORM_ENGINE_HASH TM_STATIC_HASH("tm_tween_transform_engine", 0xedeb7d9bcda108bdULL)
+
+#define TM_TWEEN_MEMBER_ENGINE "tm_tween_member_engine"
+#define TM_TWEEN_MEMBER_ENGINE_HASH TM_STATIC_HASH("tm_tween_member_engine", 0x52b19e15dd20d0ecULL)
+
 enum tm_tween_easing_item {
     TM_TWEEN_EASING_ITEM_LINEAR,
     TM_TWEEN_EASING_ITEM_INSINE,
@@ -54,4 +437,60 @@ enum tm_tween_easing_item {
     TM_TWEEN_EASING_ITEM_INBOUNCE,
     TM_TWEEN_EASING_ITEM_OUTBOUNCE,
     TM_TWEEN_EASING_ITEM_INOUTBOUNCE,
+
+    TM_TWEEN_EASING_ITEM_COUNT,
+};
+
+// Easing values from `TM_TWEEN_EASING_CUSTOM` on select the curves baked by
+// `tm_tween_api->bake_curve()`, at most `TM_TWEEN_MAX_CURVES` of them.
+#define TM_TWEEN_EASING_CUSTOM 0x1000
+#define TM_TWEEN_MAX_CURVES 4096
+
+// How single tween values are evaluated for built-in curves, see
+// `tm_tween_api->set_easing_precision()`. Maximum errors per curve are listed in easing.inl.
+enum tm_tween_easing_precision {
+    // The `double` curves of easing_curves.inl.
+    TM_TWEEN_EASING_PRECISION_EXACT,
+
+    // The single precision kernels of the batch evaluation, error below 4e-7.
+    TM_TWEEN_EASING_PRECISION_FAST,
+
+    // Linear interpolation in a 1025 entry table per curve.
+    TM_TWEEN_EASING_PRECISION_TABLE,
+
+    TM_TWEEN_EASING_PRECISION_COUNT,
+};
+
+// `repeats` of `tm_tween_api->set_repeat()` that loops the tween until it is destroyed.
+#define TM_TWEEN_REPEAT_FOREVER UINT32_MAX
+
+enum tm_tween_repeat_mode {
+    // Every cycle plays from `from` to `to`.
+    TM_TWEEN_REPEAT_RESTART,
+
+    // Cycles alternate direction, playing the easing curve backwards from `to` to `from`.
+    TM_TWEEN_REPEAT_YOYO,
+};
+
+enum tm_tween_value_type {
+    TM_TWEEN_VALUE_TYPE_FLOAT,
+    TM_TWEEN_VALUE_TYPE_VEC2,
+    TM_TWEEN_VALUE_TYPE_VEC3,
+    TM_TWEEN_VALUE_TYPE_VEC4,
+    TM_TWEEN_VALUE_TYPE_QUATERNION_NLERP,
+    TM_TWEEN_VALUE_TYPE_QUATERNION_SLERP,
+    TM_TWEEN_VALUE_TYPE_COLOR,
+
+    TM_TWEEN_VALUE_TYPE_COUNT,
+};
+
+enum tm_tween_target {
+    // `local.pos` of the entity's transform component.
+    TM_TWEEN_TARGET_POSITION,
+
+    // `local.scale` of the entity's transform component.
+    TM_TWEEN_TARGET_SCALE,
+
+    // Floats at a byte offset in any component of the entity.
+    TM_TWEEN_TARGET_MEMBER,
 };